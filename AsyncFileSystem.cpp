@@ -0,0 +1,318 @@
+// AsyncFileSystem.cpp
+#include "AsyncFileSystem.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+AsyncFileSystem* AsyncFileSystem::s_Active = nullptr;
+
+namespace
+{
+    // How long a read of each class may wait before it should be serviced
+    const std::chrono::microseconds kClassDeadlines[] = {
+        std::chrono::microseconds(5000),    // Stream (scaled down further by FMOD's priority)
+        std::chrono::microseconds(50000),   // SampleData
+        std::chrono::microseconds(250000),  // BankLoad
+    };
+
+    bool IsBankFile(const std::string& name)
+    {
+        return name.size() >= 5 && name.compare(name.size() - 5, 5, ".bank") == 0;
+    }
+}
+
+struct AsyncFileSystem::FileHandle
+{
+    std::ifstream stream;
+    std::mutex mutex;   // Workers may read the same file concurrently
+    bool isBank = false;
+    bool firstRead = true;
+    bool metadataRead = false;
+};
+
+bool AsyncFileSystem::LaterDeadline(const Request& a, const Request& b)
+{
+    // Heap comparator: the earliest deadline (then oldest request) ends up on top
+    return (a.deadline != b.deadline) ? (a.deadline > b.deadline) : (a.sequence > b.sequence);
+}
+
+AsyncFileSystem::~AsyncFileSystem()
+{
+    Shutdown();
+}
+
+FMOD_RESULT AsyncFileSystem::Install(FMOD::System* coreSystem, int workerThreads)
+{
+    if (m_Running || coreSystem == nullptr)
+    {
+        return FMOD_ERR_INVALID_PARAM;
+    }
+
+    s_Active = this;
+    m_Running = true;
+
+    workerThreads = std::max(workerThreads, 1);
+    for (int i = 0; i < workerThreads; ++i)
+    {
+        m_Workers.emplace_back(&AsyncFileSystem::WorkerLoop, this);
+    }
+
+    FMOD_RESULT result = coreSystem->setFileSystem(Open, Close, Read, Seek, AsyncRead, AsyncCancel, -1);
+    if (result != FMOD_OK)
+    {
+        Shutdown();
+    }
+
+    return result;
+}
+
+void AsyncFileSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Running)
+        {
+            return;
+        }
+        m_Running = false;
+    }
+
+    m_WorkAvailable.notify_all();
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+
+    // Fail anything FMOD is still waiting on
+    for (const Request& request : m_Queue)
+    {
+        request.info->done(request.info, FMOD_ERR_FILE_DISKEJECTED);
+    }
+    m_Queue.clear();
+
+    if (s_Active == this)
+    {
+        s_Active = nullptr;
+    }
+}
+
+AsyncFileSystemStats AsyncFileSystem::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    AsyncFileSystemStats stats = m_Stats;
+    stats.queueDepth = m_Queue.size();
+    return stats;
+}
+
+FMOD_RESULT F_CALL AsyncFileSystem::Open(const char* name, unsigned int* filesize, void** handle, void*)
+{
+    FileHandle* file = new FileHandle();
+    file->stream.open(name, std::ios::binary);
+    if (!file->stream.is_open())
+    {
+        delete file;
+        return FMOD_ERR_FILE_NOTFOUND;
+    }
+
+    file->stream.seekg(0, std::ios::end);
+    *filesize = static_cast<unsigned int>(file->stream.tellg());
+    file->stream.seekg(0, std::ios::beg);
+    file->isBank = IsBankFile(name);
+
+    *handle = file;
+    return FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AsyncFileSystem::Close(void* handle, void*)
+{
+    delete static_cast<FileHandle*>(handle);
+    return FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AsyncFileSystem::Read(void* handle, void* buffer, unsigned int sizebytes, unsigned int* bytesread, void*)
+{
+    FileHandle* file = static_cast<FileHandle*>(handle);
+    std::lock_guard<std::mutex> lock(file->mutex);
+
+    file->stream.read(static_cast<char*>(buffer), sizebytes);
+    *bytesread = static_cast<unsigned int>(file->stream.gcount());
+    file->stream.clear();
+
+    return (*bytesread < sizebytes) ? FMOD_ERR_FILE_EOF : FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AsyncFileSystem::Seek(void* handle, unsigned int pos, void*)
+{
+    FileHandle* file = static_cast<FileHandle*>(handle);
+    std::lock_guard<std::mutex> lock(file->mutex);
+
+    file->stream.clear();
+    file->stream.seekg(pos, std::ios::beg);
+    return file->stream.fail() ? FMOD_ERR_FILE_COULDNOTSEEK : FMOD_OK;
+}
+
+FMOD_RESULT AsyncFileSystem::ReadAt(FileHandle* file, unsigned int offset, void* buffer, unsigned int sizebytes, unsigned int* bytesread)
+{
+    std::lock_guard<std::mutex> lock(file->mutex);
+
+    file->stream.clear();
+    file->stream.seekg(offset, std::ios::beg);
+    if (file->stream.fail())
+    {
+        *bytesread = 0;
+        return FMOD_ERR_FILE_COULDNOTSEEK;
+    }
+
+    file->stream.read(static_cast<char*>(buffer), sizebytes);
+    *bytesread = static_cast<unsigned int>(file->stream.gcount());
+    file->stream.clear();
+
+    return (*bytesread < sizebytes) ? FMOD_ERR_FILE_EOF : FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AsyncFileSystem::AsyncRead(FMOD_ASYNCREADINFO* info, void*)
+{
+    if (s_Active == nullptr)
+    {
+        info->done(info, FMOD_ERR_FILE_DISKEJECTED);
+        return FMOD_ERR_FILE_DISKEJECTED;
+    }
+
+    return s_Active->Enqueue(info);
+}
+
+FMOD_RESULT F_CALL AsyncFileSystem::AsyncCancel(FMOD_ASYNCREADINFO* info, void*)
+{
+    return (s_Active != nullptr) ? s_Active->Cancel(info) : FMOD_OK;
+}
+
+FMOD_RESULT AsyncFileSystem::Enqueue(FMOD_ASYNCREADINFO* info)
+{
+    FileHandle* file = static_cast<FileHandle*>(info->handle);
+
+    // FMOD only raises the priority of streaming reads. For bank files, a handle
+    // whose first read is at the start of the file is the bank metadata load;
+    // sample data is read through its own handle starting at the FSB chunk.
+    Request request;
+    request.info = info;
+    if (info->priority > 0)
+    {
+        request.ioClass = AudioIoClass::Stream;
+    }
+    else
+    {
+        std::lock_guard<std::mutex> fileLock(file->mutex);
+        if (file->firstRead)
+        {
+            file->metadataRead = file->isBank && info->offset == 0;
+            file->firstRead = false;
+        }
+        request.ioClass = file->metadataRead ? AudioIoClass::BankLoad : AudioIoClass::SampleData;
+    }
+
+    std::chrono::microseconds slack = kClassDeadlines[static_cast<int>(request.ioClass)];
+    if (request.ioClass == AudioIoClass::Stream)
+    {
+        slack = slack * (101 - std::min(info->priority, 100)) / 100;
+    }
+
+    request.enqueueTime = std::chrono::steady_clock::now();
+    request.deadline = request.enqueueTime + slack;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Running)
+        {
+            info->done(info, FMOD_ERR_FILE_DISKEJECTED);
+            return FMOD_ERR_FILE_DISKEJECTED;
+        }
+
+        request.sequence = m_NextSequence++;
+        m_Queue.push_back(request);
+        std::push_heap(m_Queue.begin(), m_Queue.end(), LaterDeadline);
+        m_Stats.maxQueueDepth = std::max(m_Stats.maxQueueDepth, m_Queue.size());
+    }
+
+    m_WorkAvailable.notify_one();
+    return FMOD_OK;
+}
+
+FMOD_RESULT AsyncFileSystem::Cancel(FMOD_ASYNCREADINFO* info)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    auto it = std::find_if(m_Queue.begin(), m_Queue.end(), [info](const Request& request) {
+        return request.info == info;
+    });
+    if (it != m_Queue.end())
+    {
+        m_Queue.erase(it);
+        std::make_heap(m_Queue.begin(), m_Queue.end(), LaterDeadline);
+        ++m_Stats.cancelled;
+
+        // Signal FMOD to wake up, this operation has been cancelled
+        info->done(info, FMOD_ERR_FILE_DISKEJECTED);
+        return FMOD_ERR_FILE_DISKEJECTED;
+    }
+
+    // FMOD may free the info after we return, so wait for an in-flight read to finish
+    m_RequestFinished.wait(lock, [this, info]() {
+        return std::find(m_InFlight.begin(), m_InFlight.end(), info) == m_InFlight.end();
+    });
+
+    return FMOD_OK;
+}
+
+void AsyncFileSystem::WorkerLoop()
+{
+    for (;;)
+    {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WorkAvailable.wait(lock, [this]() { return !m_Running || !m_Queue.empty(); });
+            if (!m_Running)
+            {
+                return;
+            }
+
+            std::pop_heap(m_Queue.begin(), m_Queue.end(), LaterDeadline);
+            request = m_Queue.back();
+            m_Queue.pop_back();
+            m_InFlight.push_back(request.info);
+        }
+
+        FMOD_ASYNCREADINFO* info = request.info;
+        FMOD_RESULT result = ReadAt(static_cast<FileHandle*>(info->handle), info->offset, info->buffer, info->sizebytes, &info->bytesread);
+
+        Complete(request, result);
+    }
+}
+
+void AsyncFileSystem::Complete(const Request& request, FMOD_RESULT result)
+{
+    std::chrono::duration<float, std::milli> latency = std::chrono::steady_clock::now() - request.enqueueTime;
+    unsigned int bytesRead = request.info->bytesread;
+
+    // FMOD may reuse or free info as soon as it is signalled
+    request.info->done(request.info, result);
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        int classIndex = static_cast<int>(request.ioClass);
+        AudioIoClassStats& stats = m_Stats.classes[classIndex];
+        ++stats.requests;
+        stats.bytesRead += bytesRead;
+        m_TotalLatencyMs[classIndex] += latency.count();
+        stats.averageLatencyMs = static_cast<float>(m_TotalLatencyMs[classIndex] / static_cast<double>(stats.requests));
+        stats.maxLatencyMs = std::max(stats.maxLatencyMs, latency.count());
+
+        // Only now may a pending AsyncCancel for this request return
+        m_InFlight.erase(std::find(m_InFlight.begin(), m_InFlight.end(), request.info));
+    }
+
+    m_RequestFinished.notify_all();
+}
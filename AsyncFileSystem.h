@@ -0,0 +1,104 @@
+// AsyncFileSystem.h - Prioritized asynchronous file I/O for FMOD
+#pragma once
+
+#include <fmod.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Scheduling class of a read, in order of urgency
+enum class AudioIoClass
+{
+    Stream,      // Streaming reads FMOD flagged with a non-zero priority
+    SampleData,  // Sample data and sound file loads
+    BankLoad,    // Bank metadata reads
+    Count
+};
+
+struct AudioIoClassStats
+{
+    uint64_t requests = 0;
+    uint64_t bytesRead = 0;
+    float averageLatencyMs = 0.0f; // Queue + read time
+    float maxLatencyMs = 0.0f;
+};
+
+struct AsyncFileSystemStats
+{
+    size_t queueDepth = 0;
+    size_t maxQueueDepth = 0;
+    uint64_t cancelled = 0;
+    AudioIoClassStats classes[static_cast<int>(AudioIoClass::Count)];
+};
+
+// File system installed through System::setFileSystem. Reads are queued by
+// FMOD's userasyncread callback and serviced by a small worker pool using
+// earliest-deadline-first: streams get short deadlines, sample data longer,
+// bank loads longest, so a big bank load can't starve a playing stream.
+class AsyncFileSystem
+{
+public:
+    AsyncFileSystem() = default;
+    ~AsyncFileSystem();
+
+    AsyncFileSystem(const AsyncFileSystem&) = delete;
+    AsyncFileSystem& operator=(const AsyncFileSystem&) = delete;
+
+    // Starts the workers and registers the callbacks with the core system
+    FMOD_RESULT Install(FMOD::System* coreSystem, int workerThreads = 2);
+    void Shutdown();
+
+    AsyncFileSystemStats GetStats() const;
+
+private:
+    struct FileHandle;
+
+    struct Request
+    {
+        FMOD_ASYNCREADINFO* info = nullptr;
+        AudioIoClass ioClass = AudioIoClass::SampleData;
+        std::chrono::steady_clock::time_point enqueueTime;
+        std::chrono::steady_clock::time_point deadline;
+        uint64_t sequence = 0;
+    };
+
+    // FMOD callbacks
+    static FMOD_RESULT F_CALL Open(const char* name, unsigned int* filesize, void** handle, void* userdata);
+    static FMOD_RESULT F_CALL Close(void* handle, void* userdata);
+    static FMOD_RESULT F_CALL Read(void* handle, void* buffer, unsigned int sizebytes, unsigned int* bytesread, void* userdata);
+    static FMOD_RESULT F_CALL Seek(void* handle, unsigned int pos, void* userdata);
+    static FMOD_RESULT F_CALL AsyncRead(FMOD_ASYNCREADINFO* info, void* userdata);
+    static FMOD_RESULT F_CALL AsyncCancel(FMOD_ASYNCREADINFO* info, void* userdata);
+
+    static bool LaterDeadline(const Request& a, const Request& b);
+
+    // Seeks and reads under one hold of the file's lock, so another reader of the same
+    // handle can't move the stream in between
+    static FMOD_RESULT ReadAt(FileHandle* file, unsigned int offset, void* buffer, unsigned int sizebytes, unsigned int* bytesread);
+
+    FMOD_RESULT Enqueue(FMOD_ASYNCREADINFO* info);
+    FMOD_RESULT Cancel(FMOD_ASYNCREADINFO* info);
+    void WorkerLoop();
+    void Complete(const Request& request, FMOD_RESULT result);
+
+    // The callbacks have no context pointer, so route them to the installed instance
+    static AsyncFileSystem* s_Active;
+
+    std::vector<std::thread> m_Workers;
+    bool m_Running = false;
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_WorkAvailable;
+    std::condition_variable m_RequestFinished;
+    std::vector<Request> m_Queue;                   // Min-heap on deadline
+    std::vector<FMOD_ASYNCREADINFO*> m_InFlight;
+    uint64_t m_NextSequence = 0;
+
+    // Stats (guarded by m_Mutex)
+    AsyncFileSystemStats m_Stats;
+    double m_TotalLatencyMs[static_cast<int>(AudioIoClass::Count)] = {};
+};
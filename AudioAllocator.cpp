@@ -0,0 +1,449 @@
+// AudioAllocator.cpp
+#include "AudioAllocator.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    const int kNumClasses = AudioAllocatorStats::kNumClasses;
+    const size_t kClassSizes[kNumClasses] = { 16, 32, 64, 128, 256, 512, 1024, 2048 };
+    const size_t kSlabBytes = 64 * 1024;
+    const int kCacheBatch = 32;          // Blocks moved between a thread cache and the global list at once
+    const size_t kAlignment = 16;        // FMOD expects 16-byte aligned memory
+
+    const uint8_t kSourceArena = 0xFE;
+    const uint8_t kSourceHeap = 0xFF;
+
+    // Precedes every block handed to FMOD; keeps the payload 16-byte aligned
+    struct alignas(16) BlockHeader
+    {
+        uint32_t requestedSize;
+        uint8_t source;          // Size class index, kSourceArena or kSourceHeap
+    };
+    static_assert(sizeof(BlockHeader) == kAlignment, "BlockHeader must preserve alignment");
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        FreeBlock* freeList = nullptr;
+        std::vector<void*> slabs;
+        size_t reservedBlocks = 0;
+
+        std::atomic<size_t> liveBlocks{ 0 };
+        std::atomic<size_t> peakBlocks{ 0 };
+        std::atomic<uint64_t> allocations{ 0 };
+    };
+
+    struct AllocatorState
+    {
+        SizeClass classes[kNumClasses];
+
+        char* arena = nullptr;
+        size_t arenaCapacity = 0;
+        std::atomic<size_t> arenaOffset{ 0 };
+        std::atomic<size_t> arenaLive{ 0 };
+        std::atomic<uint64_t> arenaAllocations{ 0 };
+
+        std::atomic<uint64_t> heapAllocations{ 0 };
+        std::atomic<size_t> liveBytes{ 0 };
+        std::atomic<size_t> peakBytes{ 0 };
+
+        bool installed = false;
+    };
+
+    // Intentionally leaked: FMOD threads may free memory during static destruction
+    AllocatorState& State()
+    {
+        static AllocatorState* state = new AllocatorState();
+        return *state;
+    }
+
+    void UpdatePeak(std::atomic<size_t>& peak, size_t value)
+    {
+        size_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    int ClassForSize(size_t size)
+    {
+        for (int i = 0; i < kNumClasses; ++i)
+        {
+            if (size <= kClassSizes[i])
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    size_t BlockBytes(int sizeClass)
+    {
+        return sizeof(BlockHeader) + kClassSizes[sizeClass];
+    }
+
+    // Takes up to 'count' blocks from the global list (carving a new slab if needed)
+    FreeBlock* TakeBlocks(int sizeClass, int count, int& taken)
+    {
+        SizeClass& pool = State().classes[sizeClass];
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        if (pool.freeList == nullptr)
+        {
+            char* slab = static_cast<char*>(std::malloc(kSlabBytes));
+            if (slab == nullptr)
+            {
+                taken = 0;
+                return nullptr;
+            }
+            pool.slabs.push_back(slab);
+
+            size_t blockBytes = BlockBytes(sizeClass);
+            size_t blocks = kSlabBytes / blockBytes;
+            for (size_t i = 0; i < blocks; ++i)
+            {
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * blockBytes);
+                block->next = pool.freeList;
+                pool.freeList = block;
+            }
+            pool.reservedBlocks += blocks;
+        }
+
+        FreeBlock* head = pool.freeList;
+        FreeBlock* tail = head;
+        taken = 1;
+        while (taken < count && tail->next != nullptr)
+        {
+            tail = tail->next;
+            ++taken;
+        }
+        pool.freeList = tail->next;
+        tail->next = nullptr;
+        return head;
+    }
+
+    void ReturnBlocks(int sizeClass, FreeBlock* head, FreeBlock* tail)
+    {
+        SizeClass& pool = State().classes[sizeClass];
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        tail->next = pool.freeList;
+        pool.freeList = head;
+    }
+
+    // Per-thread free lists so the mixer thread's steady-state churn never locks
+    struct ThreadCache
+    {
+        FreeBlock* heads[kNumClasses] = {};
+        int counts[kNumClasses] = {};
+
+        ~ThreadCache()
+        {
+            for (int i = 0; i < kNumClasses; ++i)
+            {
+                if (heads[i] != nullptr)
+                {
+                    FreeBlock* tail = heads[i];
+                    while (tail->next != nullptr)
+                    {
+                        tail = tail->next;
+                    }
+                    ReturnBlocks(i, heads[i], tail);
+                    heads[i] = nullptr;
+                    counts[i] = 0;
+                }
+            }
+        }
+
+        void* Pop(int sizeClass)
+        {
+            if (heads[sizeClass] == nullptr)
+            {
+                int taken = 0;
+                heads[sizeClass] = TakeBlocks(sizeClass, kCacheBatch, taken);
+                counts[sizeClass] = taken;
+                if (heads[sizeClass] == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            FreeBlock* block = heads[sizeClass];
+            heads[sizeClass] = block->next;
+            --counts[sizeClass];
+            return block;
+        }
+
+        void Push(int sizeClass, void* memory)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(memory);
+            block->next = heads[sizeClass];
+            heads[sizeClass] = block;
+            ++counts[sizeClass];
+
+            // Give a batch back so blocks freed on one thread can be reused by others
+            if (counts[sizeClass] > kCacheBatch * 2)
+            {
+                FreeBlock* head = heads[sizeClass];
+                FreeBlock* tail = head;
+                for (int i = 1; i < kCacheBatch; ++i)
+                {
+                    tail = tail->next;
+                }
+                heads[sizeClass] = tail->next;
+                counts[sizeClass] -= kCacheBatch;
+                ReturnBlocks(sizeClass, head, tail);
+            }
+        }
+    };
+
+    thread_local ThreadCache t_Cache;
+
+    void* ArenaAlloc(size_t bytes)
+    {
+        AllocatorState& state = State();
+        if (state.arena == nullptr)
+        {
+            return nullptr;
+        }
+
+        // Only claim the range once it is known to fit, so a failed request doesn't
+        // use up the rest of the arena
+        size_t aligned = (bytes + kAlignment - 1) & ~(kAlignment - 1);
+        size_t offset = state.arenaOffset.load(std::memory_order_relaxed);
+        do
+        {
+            if (offset + aligned > state.arenaCapacity)
+            {
+                return nullptr;
+            }
+        } while (!state.arenaOffset.compare_exchange_weak(offset, offset + aligned, std::memory_order_relaxed));
+
+        state.arenaLive.fetch_add(1, std::memory_order_relaxed);
+        state.arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+        return state.arena + offset;
+    }
+}
+
+FMOD_RESULT AudioAllocator::Install(size_t arenaBytes)
+{
+    AllocatorState& state = State();
+    if (state.installed)
+    {
+        return FMOD_OK;
+    }
+
+    if (arenaBytes > 0)
+    {
+        state.arena = static_cast<char*>(std::malloc(arenaBytes));
+        state.arenaCapacity = (state.arena != nullptr) ? arenaBytes : 0;
+    }
+
+    FMOD_RESULT result = FMOD::Memory_Initialize(nullptr, 0, Alloc, Realloc, Free, FMOD_MEMORY_ALL);
+    if (result != FMOD_OK)
+    {
+        std::free(state.arena);
+        state.arena = nullptr;
+        state.arenaCapacity = 0;
+        return result;
+    }
+
+    state.installed = true;
+    return FMOD_OK;
+}
+
+bool AudioAllocator::IsInstalled()
+{
+    return State().installed;
+}
+
+void AudioAllocator::ResetArenaIfUnused()
+{
+    AllocatorState& state = State();
+    if (state.arenaLive.load() == 0)
+    {
+        state.arenaOffset.store(0);
+    }
+}
+
+void* F_CALL AudioAllocator::Alloc(unsigned int size, FMOD_MEMORY_TYPE type, const char*)
+{
+    AllocatorState& state = State();
+    size_t totalBytes = sizeof(BlockHeader) + size;
+
+    BlockHeader* header = nullptr;
+    int sizeClass = ClassForSize(size);
+
+    if ((type & FMOD_MEMORY_PERSISTENT) != 0)
+    {
+        header = static_cast<BlockHeader*>(ArenaAlloc(totalBytes));
+        if (header != nullptr)
+        {
+            header->source = kSourceArena;
+        }
+    }
+
+    if (header == nullptr && sizeClass >= 0)
+    {
+        header = static_cast<BlockHeader*>(t_Cache.Pop(sizeClass));
+        if (header != nullptr)
+        {
+            header->source = static_cast<uint8_t>(sizeClass);
+
+            SizeClass& pool = state.classes[sizeClass];
+            pool.allocations.fetch_add(1, std::memory_order_relaxed);
+            size_t live = pool.liveBlocks.fetch_add(1, std::memory_order_relaxed) + 1;
+            UpdatePeak(pool.peakBlocks, live);
+        }
+    }
+
+    if (header == nullptr)
+    {
+        // malloc only guarantees 16-byte alignment on 64-bit targets, which is what we build for
+        header = static_cast<BlockHeader*>(std::malloc(totalBytes));
+        if (header == nullptr)
+        {
+            return nullptr;
+        }
+        header->source = kSourceHeap;
+        state.heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    header->requestedSize = size;
+    size_t live = state.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    UpdatePeak(state.peakBytes, live);
+
+    return header + 1;
+}
+
+void* F_CALL AudioAllocator::Realloc(void* ptr, unsigned int size, FMOD_MEMORY_TYPE type, const char* sourcestr)
+{
+    if (ptr == nullptr)
+    {
+        return Alloc(size, type, sourcestr);
+    }
+
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+
+    // Grow or shrink in place while it still fits the same pool block
+    if (header->source < kNumClasses && size <= kClassSizes[header->source])
+    {
+        AllocatorState& state = State();
+        state.liveBytes.fetch_sub(header->requestedSize, std::memory_order_relaxed);
+        size_t live = state.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        UpdatePeak(state.peakBytes, live);
+        header->requestedSize = size;
+        return ptr;
+    }
+
+    void* memory = Alloc(size, type, sourcestr);
+    if (memory != nullptr)
+    {
+        std::memcpy(memory, ptr, std::min<size_t>(size, header->requestedSize));
+        Free(ptr, type, sourcestr);
+    }
+
+    return memory;
+}
+
+void F_CALL AudioAllocator::Free(void* ptr, FMOD_MEMORY_TYPE, const char*)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    AllocatorState& state = State();
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    state.liveBytes.fetch_sub(header->requestedSize, std::memory_order_relaxed);
+
+    if (header->source < kNumClasses)
+    {
+        int sizeClass = header->source;
+        state.classes[sizeClass].liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+        t_Cache.Push(sizeClass, header);
+    }
+    else if (header->source == kSourceArena)
+    {
+        // Arena memory is reclaimed all at once by ResetArenaIfUnused
+        state.arenaLive.fetch_sub(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        std::free(header);
+    }
+}
+
+AudioAllocatorStats AudioAllocator::GetStats()
+{
+    AllocatorState& state = State();
+
+    AudioAllocatorStats stats;
+    stats.liveBytes = state.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = state.peakBytes.load(std::memory_order_relaxed);
+    stats.arenaUsedBytes = state.arenaOffset.load(std::memory_order_relaxed);
+    stats.arenaCapacityBytes = state.arenaCapacity;
+    stats.arenaAllocations = state.arenaAllocations.load(std::memory_order_relaxed);
+    stats.heapAllocations = state.heapAllocations.load(std::memory_order_relaxed);
+
+    for (int i = 0; i < kNumClasses; ++i)
+    {
+        SizeClass& pool = state.classes[i];
+        AudioAllocatorClassStats& classStats = stats.classes[i];
+        classStats.blockSize = kClassSizes[i];
+        classStats.liveBlocks = pool.liveBlocks.load(std::memory_order_relaxed);
+        classStats.peakBlocks = pool.peakBlocks.load(std::memory_order_relaxed);
+        classStats.allocations = pool.allocations.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        classStats.reservedBlocks = pool.reservedBlocks;
+    }
+
+    return stats;
+}
+
+void AudioAllocator::PrintReport(std::ostream& out)
+{
+    AudioAllocatorStats stats = GetStats();
+    std::ios::fmtflags flags = out.flags();
+
+    size_t reservedPoolBytes = 0;
+    size_t livePoolBytes = 0;
+
+    out << "FMOD allocator: " << stats.liveBytes << " bytes live, " << stats.peakBytes << " bytes peak" << std::endl;
+    out << "  class    live    peak  reserved      allocs" << std::endl;
+    for (const AudioAllocatorClassStats& classStats : stats.classes)
+    {
+        reservedPoolBytes += classStats.reservedBlocks * classStats.blockSize;
+        livePoolBytes += classStats.liveBlocks * classStats.blockSize;
+
+        out << std::setw(7) << classStats.blockSize
+            << std::setw(8) << classStats.liveBlocks
+            << std::setw(8) << classStats.peakBlocks
+            << std::setw(10) << classStats.reservedBlocks
+            << std::setw(12) << classStats.allocations << std::endl;
+    }
+
+    // External fragmentation: pool memory reserved but currently unused
+    float fragmentation = (reservedPoolBytes > 0)
+        ? 100.0f * static_cast<float>(reservedPoolBytes - livePoolBytes) / static_cast<float>(reservedPoolBytes)
+        : 0.0f;
+
+    out << "  pools: " << livePoolBytes << " / " << reservedPoolBytes << " bytes in use ("
+        << std::fixed << std::setprecision(1) << fragmentation << "% idle)" << std::endl;
+    out << "  arena: " << stats.arenaUsedBytes << " / " << stats.arenaCapacityBytes << " bytes, "
+        << stats.arenaAllocations << " allocs" << std::endl;
+    out << "  heap fallback: " << stats.heapAllocations << " allocs" << std::endl;
+
+    out.flags(flags);
+}
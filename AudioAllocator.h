@@ -0,0 +1,57 @@
+// AudioAllocator.h - Pooled allocator installed into FMOD via Memory_Initialize
+#pragma once
+
+#include <fmod.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+struct AudioAllocatorClassStats
+{
+    size_t blockSize = 0;
+    size_t liveBlocks = 0;
+    size_t peakBlocks = 0;
+    size_t reservedBlocks = 0;  // Carved from slabs, live or free
+    uint64_t allocations = 0;
+};
+
+struct AudioAllocatorStats
+{
+    static const int kNumClasses = 8;
+
+    size_t liveBytes = 0;       // Bytes requested by FMOD and not yet freed
+    size_t peakBytes = 0;       // High-water mark of liveBytes
+    size_t arenaUsedBytes = 0;
+    size_t arenaCapacityBytes = 0;
+    uint64_t arenaAllocations = 0;
+    uint64_t heapAllocations = 0;  // Large or overflow allocations
+    AudioAllocatorClassStats classes[kNumClasses];
+};
+
+// Routes every FMOD allocation through fixed-size block pools (16 B - 2 KB),
+// with thread-local free-block caches so FMOD's mixer and streaming threads
+// rarely touch a lock. Persistent allocations (freed only by System::release)
+// are bump-allocated from a single arena; everything else larger than the
+// largest pool falls back to the heap.
+//
+// FMOD only accepts Memory_Initialize before any system is created, and the
+// callbacks must stay valid for the rest of the process, so this is installed
+// once and never removed.
+class AudioAllocator
+{
+public:
+    static FMOD_RESULT Install(size_t arenaBytes = 4 * 1024 * 1024);
+    static bool IsInstalled();
+
+    // Rewinds the persistent arena once nothing lives in it (after System::release)
+    static void ResetArenaIfUnused();
+
+    static AudioAllocatorStats GetStats();
+    static void PrintReport(std::ostream& out);
+
+    // The callbacks handed to Memory_Initialize; usable directly (e.g. by
+    // AudioBenchmarks) whether or not the allocator is installed
+    static void* F_CALL Alloc(unsigned int size, FMOD_MEMORY_TYPE type, const char* sourcestr);
+    static void* F_CALL Realloc(void* ptr, unsigned int size, FMOD_MEMORY_TYPE type, const char* sourcestr);
+    static void F_CALL Free(void* ptr, FMOD_MEMORY_TYPE type, const char* sourcestr);
+};
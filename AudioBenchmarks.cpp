@@ -0,0 +1,809 @@
+// AudioBenchmarks.cpp
+#include "AudioBenchmarks.h"
+#include "AudioAllocator.h"
+#include "AudioCommandQueue.h"
+#include "AudioEventSlotMap.h"
+#include "AudioTickScheduler.h"
+#include "EmitterStore.h"
+#include "EventInstancePool.h"
+#include "FMODAudioSystem.h"
+#include "MpscRing.h"
+#include "OcclusionGeometry.h"
+#include "SpatialHashGrid.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedNs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    // Starts fn on every thread at once and returns the wall time until all finish
+    template <typename Fn>
+    double RunOnThreads(int threads, Fn fn)
+    {
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&go, &fn, t]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                fn(t);
+            });
+        }
+
+        Clock::time_point start = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        return ElapsedNs(start);
+    }
+
+    // OcclusionGeometry::Query without the hierarchy: the same crossing test against every wall
+    float BruteForceOcclusion(const std::vector<OcclusionWall>& walls, float ax, float ay, float bx, float by)
+    {
+        float dx = bx - ax;
+        float dy = by - ay;
+        float transmission = 1.0f;
+        for (const OcclusionWall& wall : walls)
+        {
+            float ex = wall.x1 - wall.x0;
+            float ey = wall.y1 - wall.y0;
+            float denominator = dx * ey - dy * ex;
+            if (denominator == 0.0f)
+            {
+                continue;
+            }
+
+            float fx = wall.x0 - ax;
+            float fy = wall.y0 - ay;
+            float t = (fx * ey - fy * ex) / denominator;
+            float u = (fx * dy - fy * dx) / denominator;
+            if (t >= 0.0f && t <= 1.0f && u >= 0.0f && u <= 1.0f)
+            {
+                transmission *= 1.0f - wall.occlusion;
+            }
+        }
+        return 1.0f - transmission;
+    }
+
+    // Event description for the FMOD-backed benchmarks, or null (with a note) if it isn't loaded
+    FMOD::Studio::EventDescription* FindBenchmarkEvent(std::ostream& out, const char* benchmark, const std::string& eventPath)
+    {
+        FMOD::Studio::EventDescription* description = FMODAudioSystem::GetInstance().GetEventDescription(AudioEventId(eventPath));
+        if (description == nullptr)
+        {
+            out << benchmark << ": skipped, '" << eventPath << "' isn't loaded" << std::endl;
+        }
+        return description;
+    }
+
+    // Unstarted instances stand in for emitters: set3DAttributes costs the same
+    // command-queue write as on a playing event
+    std::vector<FMOD::Studio::EventInstance*> CreateInstances(FMOD::Studio::EventDescription* description, int count)
+    {
+        std::vector<FMOD::Studio::EventInstance*> instances;
+        instances.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            FMOD::Studio::EventInstance* instance = nullptr;
+            if (description->createInstance(&instance) != FMOD_OK)
+            {
+                break;
+            }
+            instances.push_back(instance);
+        }
+        return instances;
+    }
+
+    void ReleaseInstances(std::vector<FMOD::Studio::EventInstance*>& instances)
+    {
+        for (FMOD::Studio::EventInstance* instance : instances)
+        {
+            instance->release();
+        }
+        instances.clear();
+        FMODAudioSystem::GetInstance().GetStudioSystem()->flushCommands();
+    }
+}
+
+void AudioBenchmarks::RunAll(std::ostream& out, const std::string& eventPath)
+{
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(2);
+
+    Allocator(out);
+    CommandQueue(out);
+    SpatialGrid(out);
+    OcclusionBvh(out);
+    EventSlotMap(out);
+    LifetimeNotices(out);
+
+    if (!eventPath.empty())
+    {
+        InstancePool(out, eventPath);
+        EmitterFlush(out, eventPath);
+        MultiListenerEmitters(out, eventPath);
+    }
+
+    out.flags(flags);
+}
+
+void AudioBenchmarks::Allocator(std::ostream& out)
+{
+    const int kRounds = 2000;
+    const int kBatch = 256;
+
+    // Mostly small blocks like FMOD's command and DSP allocations, with a tail up to 2 KB.
+    // Blocks are freed in shuffled order so neither side gets a perfect LIFO pattern.
+    std::mt19937 rng(12345);
+    std::vector<unsigned int> sizes(kBatch);
+    for (unsigned int& size : sizes)
+    {
+        unsigned int bucket = rng() % 100;
+        size = (bucket < 60) ? 16 + rng() % 112 : (bucket < 90) ? 128 + rng() % 384 : 512 + rng() % 1536;
+    }
+
+    std::vector<int> freeOrder(kBatch);
+    for (int i = 0; i < kBatch; ++i)
+    {
+        freeOrder[i] = i;
+    }
+    std::shuffle(freeOrder.begin(), freeOrder.end(), rng);
+
+    auto poolRun = [&](int) {
+        std::vector<void*> blocks(kBatch);
+        for (int round = 0; round < kRounds; ++round)
+        {
+            for (int i = 0; i < kBatch; ++i)
+            {
+                blocks[i] = AudioAllocator::Alloc(sizes[i], FMOD_MEMORY_NORMAL, nullptr);
+            }
+            for (int i : freeOrder)
+            {
+                AudioAllocator::Free(blocks[i], FMOD_MEMORY_NORMAL, nullptr);
+            }
+        }
+    };
+
+    auto heapRun = [&](int) {
+        std::vector<void*> blocks(kBatch);
+        for (int round = 0; round < kRounds; ++round)
+        {
+            for (int i = 0; i < kBatch; ++i)
+            {
+                blocks[i] = std::malloc(sizes[i]);
+            }
+            for (int i : freeOrder)
+            {
+                std::free(blocks[i]);
+            }
+        }
+    };
+
+    out << "Allocator (" << kRounds << " x " << kBatch << " alloc/free pairs per thread)" << std::endl;
+    for (int threads : { 1, 2, 4, 8 })
+    {
+        double operations = static_cast<double>(threads) * kRounds * kBatch * 2;
+        double poolNs = RunOnThreads(threads, poolRun);
+        double heapNs = RunOnThreads(threads, heapRun);
+
+        out << "  " << threads << " threads: pool " << poolNs / operations << " ns/op ("
+            << operations / poolNs * 1000.0 << " Mops/s), heap " << heapNs / operations << " ns/op ("
+            << operations / heapNs * 1000.0 << " Mops/s)" << std::endl;
+    }
+}
+
+void AudioBenchmarks::CommandQueue(std::ostream& out)
+{
+    const int kProducers = 8;
+    const int kPostsPerProducer = 100000;
+    const int kPacedBurst = 64;  // Posts per producer per millisecond when paced
+
+    out << "Command queue (" << kProducers << " producers x " << kPostsPerProducer << " posts)" << std::endl;
+    for (bool paced : { false, true })
+    {
+        AudioCommandQueue queue;
+        std::atomic<int> producersDone{ 0 };
+        std::atomic<uint64_t> fullRetries{ 0 };
+        std::vector<double> postNs(kProducers, 0.0);
+        TimingHistogram latencyMs;
+
+        // The consumer stands in for the audio thread's drain loop
+        std::thread consumer([&]() {
+            AudioCommand command;
+            for (;;)
+            {
+                if (queue.Pop(command))
+                {
+                    std::chrono::duration<float, std::milli> latency = Clock::now() - command.postTime;
+                    latencyMs.Record(latency.count());
+                }
+                else if (producersDone.load(std::memory_order_acquire) == kProducers)
+                {
+                    // Producers are finished; one more pass picks up the last posts
+                    if (!queue.Pop(command))
+                    {
+                        break;
+                    }
+                    std::chrono::duration<float, std::milli> latency = Clock::now() - command.postTime;
+                    latencyMs.Record(latency.count());
+                }
+            }
+        });
+
+        double wallNs = RunOnThreads(kProducers, [&](int producer) {
+            AudioCommand command;
+            command.type = AudioCommandType::SetEventPosition;
+            double spentNs = 0.0;
+            for (int i = 0; i < kPostsPerProducer; ++i)
+            {
+                if (paced && i > 0 && i % kPacedBurst == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+
+                Clock::time_point start = Clock::now();
+                command.x = static_cast<float>(i);
+                command.postTime = start;
+                while (!queue.Push(command))
+                {
+                    fullRetries.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                }
+                spentNs += ElapsedNs(start);
+            }
+            postNs[producer] = spentNs;
+            producersDone.fetch_add(1, std::memory_order_release);
+        });
+        consumer.join();
+
+        double posts = static_cast<double>(kProducers) * kPostsPerProducer;
+        double totalPostNs = 0.0;
+        for (double ns : postNs)
+        {
+            totalPostNs += ns;
+        }
+
+        out << "  " << (paced ? "paced:  " : "flat out:") << " " << posts / wallNs * 1000.0 << " Mposts/s, "
+            << totalPostNs / posts << " ns/post, " << fullRetries.load() << " full retries, latency p50 "
+            << latencyMs.GetPercentile(0.5f) << " ms, p99 " << latencyMs.GetPercentile(0.99f) << " ms, max "
+            << latencyMs.GetMax() << " ms (" << latencyMs.GetCount() << " drained)" << std::endl;
+    }
+}
+
+void AudioBenchmarks::SpatialGrid(std::ostream& out)
+{
+    const float kWorldSize = 10000.0f;
+    const float kCellSize = 50.0f;
+    const float kRadius = 200.0f;
+    const int kQueries = 1000;
+
+    out << "Spatial hash grid (" << static_cast<int>(kWorldSize) << " x " << static_cast<int>(kWorldSize) << " area, "
+        << static_cast<int>(kCellSize) << "-unit cells, radius " << static_cast<int>(kRadius) << ", " << kQueries << " queries)" << std::endl;
+    for (int count : { 1000, 10000, 100000 })
+    {
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> coordinate(0.0f, kWorldSize);
+
+        SpatialHashGrid grid(kCellSize);
+        std::vector<float> xs(count);
+        std::vector<float> ys(count);
+        for (int i = 0; i < count; ++i)
+        {
+            xs[i] = coordinate(rng);
+            ys[i] = coordinate(rng);
+            grid.Insert(static_cast<uint32_t>(i), xs[i], ys[i]);
+        }
+
+        std::vector<float> queryX(kQueries);
+        std::vector<float> queryY(kQueries);
+        for (int q = 0; q < kQueries; ++q)
+        {
+            queryX[q] = coordinate(rng);
+            queryY[q] = coordinate(rng);
+        }
+
+        std::vector<std::vector<uint32_t>> gridResults(kQueries);
+        Clock::time_point start = Clock::now();
+        for (int q = 0; q < kQueries; ++q)
+        {
+            grid.QueryRadius(queryX[q], queryY[q], kRadius, gridResults[q]);
+        }
+        double gridNs = ElapsedNs(start);
+
+        std::vector<std::vector<uint32_t>> bruteResults(kQueries);
+        start = Clock::now();
+        for (int q = 0; q < kQueries; ++q)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                float dx = xs[i] - queryX[q];
+                float dy = ys[i] - queryY[q];
+                if (dx * dx + dy * dy <= kRadius * kRadius)
+                {
+                    bruteResults[q].push_back(static_cast<uint32_t>(i));
+                }
+            }
+        }
+        double bruteNs = ElapsedNs(start);
+
+        size_t hits = 0;
+        int mismatches = 0;
+        for (int q = 0; q < kQueries; ++q)
+        {
+            std::sort(gridResults[q].begin(), gridResults[q].end());
+            mismatches += (gridResults[q] != bruteResults[q]) ? 1 : 0;
+            hits += bruteResults[q].size();
+        }
+
+        out << "  " << count << " IDs: grid " << gridNs / kQueries / 1000.0 << " us/query, brute force "
+            << bruteNs / kQueries / 1000.0 << " us/query, " << static_cast<double>(hits) / kQueries << " hits/query, "
+            << mismatches << " mismatched queries" << std::endl;
+    }
+}
+
+void AudioBenchmarks::OcclusionBvh(std::ostream& out)
+{
+    const float kWorldSize = 10000.0f;
+    const int kWalls = 5000;
+    const int kTraces = 2000;
+
+    // Short walls scattered over the level; partial occlusion so no trace stops early
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> coordinate(0.0f, kWorldSize);
+    std::uniform_real_distribution<float> offset(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> occlusion(0.05f, 0.3f);
+    std::vector<OcclusionWall> walls(kWalls);
+    for (OcclusionWall& wall : walls)
+    {
+        wall.x0 = coordinate(rng);
+        wall.y0 = coordinate(rng);
+        wall.x1 = wall.x0 + offset(rng);
+        wall.y1 = wall.y0 + offset(rng);
+        wall.occlusion = occlusion(rng);
+    }
+
+    // Emitter-to-listener traces up to a few hundred units long
+    std::uniform_real_distribution<float> reach(-400.0f, 400.0f);
+    std::vector<float> traces(kTraces * 4);
+    for (int i = 0; i < kTraces; ++i)
+    {
+        traces[i * 4 + 0] = coordinate(rng);
+        traces[i * 4 + 1] = coordinate(rng);
+        traces[i * 4 + 2] = traces[i * 4 + 0] + reach(rng);
+        traces[i * 4 + 3] = traces[i * 4 + 1] + reach(rng);
+    }
+
+    Clock::time_point start = Clock::now();
+    OcclusionGeometry geometry(walls);
+    double buildNs = ElapsedNs(start);
+
+    std::vector<float> bvhResults(kTraces);
+    start = Clock::now();
+    for (int i = 0; i < kTraces; ++i)
+    {
+        bvhResults[i] = geometry.Query(traces[i * 4 + 0], traces[i * 4 + 1], traces[i * 4 + 2], traces[i * 4 + 3]);
+    }
+    double bvhNs = ElapsedNs(start);
+
+    std::vector<float> bruteResults(kTraces);
+    start = Clock::now();
+    for (int i = 0; i < kTraces; ++i)
+    {
+        bruteResults[i] = BruteForceOcclusion(walls, traces[i * 4 + 0], traces[i * 4 + 1], traces[i * 4 + 2], traces[i * 4 + 3]);
+    }
+    double bruteNs = ElapsedNs(start);
+
+    // The BVH multiplies the crossed walls in a different order, so allow rounding
+    int mismatches = 0;
+    int occluded = 0;
+    for (int i = 0; i < kTraces; ++i)
+    {
+        mismatches += (std::abs(bvhResults[i] - bruteResults[i]) > 1e-4f) ? 1 : 0;
+        occluded += (bruteResults[i] > 0.0f) ? 1 : 0;
+    }
+
+    out << "Occlusion BVH (" << kWalls << " walls, " << kTraces << " traces, built in " << buildNs / 1e6 << " ms)" << std::endl;
+    out << "  BVH " << bvhNs / kTraces / 1000.0 << " us/query, brute force " << bruteNs / kTraces / 1000.0 << " us/query, "
+        << occluded << " occluded traces, " << mismatches << " mismatched" << std::endl;
+}
+
+void AudioBenchmarks::EventSlotMap(std::ostream& out)
+{
+    const int kRecords = 5000;
+    const int kRounds = 100;
+    const int kPaths = 16;
+
+    // The map only stores instance pointers, so fake ones will do
+    std::vector<FMOD::Studio::EventInstance*> instances(kRecords);
+    for (int i = 0; i < kRecords; ++i)
+    {
+        instances[i] = reinterpret_cast<FMOD::Studio::EventInstance*>(static_cast<uintptr_t>(i + 1) * 64);
+    }
+
+    std::vector<std::string> pathStrings;
+    for (int i = 0; i < kPaths; ++i)
+    {
+        pathStrings.push_back("event:/Benchmark/Event" + std::to_string(i));
+    }
+    std::vector<AudioEventId> paths(pathStrings.begin(), pathStrings.end());
+
+    std::mt19937 rng(12345);
+    std::vector<int> eraseOrder(kRecords);
+    for (int i = 0; i < kRecords; ++i)
+    {
+        eraseOrder[i] = i;
+    }
+    std::shuffle(eraseOrder.begin(), eraseOrder.end(), rng);
+
+    AudioEventSlotMap slotMap;
+    slotMap.Reserve(kRecords);
+
+    std::vector<AudioEventHandle> handles(kRecords);
+    size_t staleAccepted = 0;
+    Clock::time_point start = Clock::now();
+    for (int round = 0; round < kRounds; ++round)
+    {
+        for (int i = 0; i < kRecords; ++i)
+        {
+            handles[i] = slotMap.Insert(instances[i], paths[i % kPaths], kAudioEventOwned);
+        }
+        for (int i : eraseOrder)
+        {
+            slotMap.Erase(handles[i]);
+        }
+    }
+    double slotMapNs = ElapsedNs(start);
+
+    // Every handle from the last round has been erased; none may resolve
+    for (AudioEventHandle handle : handles)
+    {
+        staleAccepted += (slotMap.Get(handle) != nullptr) ? 1 : 0;
+    }
+
+    struct MapRecord
+    {
+        FMOD::Studio::EventInstance* instance;
+        uint32_t pathId;
+        uint8_t flags;
+    };
+    std::unordered_map<uint64_t, MapRecord> map;
+    std::vector<uint64_t> keys(kRecords);
+    uint64_t nextKey = 1;
+    start = Clock::now();
+    for (int round = 0; round < kRounds; ++round)
+    {
+        for (int i = 0; i < kRecords; ++i)
+        {
+            keys[i] = nextKey++;
+            map.emplace(keys[i], MapRecord{ instances[i], static_cast<uint32_t>(i % kPaths), kAudioEventOwned });
+        }
+        for (int i : eraseOrder)
+        {
+            map.erase(keys[i]);
+        }
+    }
+    double mapNs = ElapsedNs(start);
+
+    double pairs = static_cast<double>(kRecords) * kRounds;
+    out << "Event slot map (" << kRecords << " inserts + erases x " << kRounds << ")" << std::endl;
+    out << "  slot map " << slotMapNs / pairs << " ns/pair, unordered_map " << mapNs / pairs << " ns/pair, "
+        << slotMap.Capacity() << " slots used, " << staleAccepted << " stale handles accepted" << std::endl;
+}
+
+void AudioBenchmarks::LifetimeNotices(std::ostream& out)
+{
+    const int kLiveRecords = 5000;
+    const int kEndingPerTick = 20;
+    const int kTicks = 2000;
+
+    struct Notice
+    {
+        FMOD::Studio::EventInstance* instance = nullptr;
+        uint32_t slot = 0;
+    };
+
+    // One fake instance per slot; an ended record is replaced at once, so it reuses its slot
+    std::vector<FMOD::Studio::EventInstance*> instances(kLiveRecords);
+    for (int i = 0; i < kLiveRecords; ++i)
+    {
+        instances[i] = reinterpret_cast<FMOD::Studio::EventInstance*>(static_cast<uintptr_t>(i + 1) * 64);
+    }
+
+    AudioEventSlotMap slotMap;
+    slotMap.Reserve(kLiveRecords);
+    AudioEventId eventId = "event:/Benchmark/Loop"_event;
+    for (int i = 0; i < kLiveRecords; ++i)
+    {
+        slotMap.Insert(instances[i], eventId, kAudioEventOwned);
+    }
+
+    // The producer stands in for the Studio update thread's destroyed callbacks
+    MpscRing<Notice> notices(8192);
+    std::atomic<int> requestedTick{ -1 };
+    std::atomic<int> postedTick{ -1 };
+    std::thread producer([&]() {
+        std::mt19937 rng(12345);
+        for (int tick = 0; tick < kTicks; ++tick)
+        {
+            while (requestedTick.load(std::memory_order_acquire) < tick)
+            {
+                std::this_thread::yield();
+            }
+
+            for (int i = 0; i < kEndingPerTick; ++i)
+            {
+                Notice notice;
+                notice.slot = static_cast<uint32_t>(rng() % kLiveRecords);
+                notice.instance = instances[notice.slot];
+                notices.Push(notice);
+            }
+            postedTick.store(tick, std::memory_order_release);
+        }
+    });
+
+    double drainNs = 0.0;
+    uint64_t ended = 0;
+    for (int tick = 0; tick < kTicks; ++tick)
+    {
+        requestedTick.store(tick, std::memory_order_release);
+        while (postedTick.load(std::memory_order_acquire) < tick)
+        {
+            std::this_thread::yield();
+        }
+
+        Clock::time_point start = Clock::now();
+        Notice notice;
+        while (notices.Pop(notice))
+        {
+            AudioEventHandle handle = slotMap.HandleAt(notice.slot);
+            AudioEventRecord* record = slotMap.Get(handle);
+            if (record == nullptr || record->instance != notice.instance)
+            {
+                continue;
+            }
+
+            slotMap.Erase(handle);
+            slotMap.Insert(notice.instance, eventId, kAudioEventOwned);
+            ++ended;
+        }
+        drainNs += ElapsedNs(start);
+    }
+    producer.join();
+
+    // Visiting every record is a lower bound for polling; the real poll made an FMOD
+    // getPlaybackState call per record on top of this
+    std::vector<uint8_t> playing(kLiveRecords, 1);
+    size_t stopped = 0;
+    Clock::time_point start = Clock::now();
+    for (int tick = 0; tick < kTicks; ++tick)
+    {
+        for (uint32_t slot = 0; slot < slotMap.Capacity(); ++slot)
+        {
+            const AudioEventRecord* record = slotMap.Get(slotMap.HandleAt(slot));
+            if (record != nullptr && !playing[slot])
+            {
+                ++stopped;
+            }
+        }
+    }
+    double scanNs = ElapsedNs(start);
+
+    out << "Lifetime notices (" << slotMap.Size() << " live records, " << kEndingPerTick << " ending per tick, "
+        << kTicks << " ticks)" << std::endl;
+    out << "  ring drain " << drainNs / kTicks / 1000.0 << " us/tick (" << ended << " records ended), full scan "
+        << scanNs / kTicks / 1000.0 << " us/tick before any FMOD calls (" << stopped << " stopped)" << std::endl;
+}
+
+void AudioBenchmarks::InstancePool(std::ostream& out, const std::string& eventPath)
+{
+    const int kRounds = 200;
+    const int kBurst = 64;
+
+    FMOD::Studio::EventDescription* description = FindBenchmarkEvent(out, "Instance pool", eventPath);
+    if (description == nullptr)
+    {
+        return;
+    }
+    FMOD::Studio::System* studioSystem = FMODAudioSystem::GetInstance().GetStudioSystem();
+
+    // Current path: a new instance per play, released to die when it stops
+    double createNs = 0.0;
+    for (int round = 0; round < kRounds; ++round)
+    {
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < kBurst; ++i)
+        {
+            FMOD::Studio::EventInstance* instance = nullptr;
+            if (description->createInstance(&instance) == FMOD_OK)
+            {
+                instance->start();
+                instance->release();
+            }
+        }
+        createNs += ElapsedNs(start);
+
+        description->releaseAllInstances();
+        studioSystem->flushCommands();
+    }
+
+    // Pooled path: stopped instances come back through the pool's STOPPED callback
+    EventInstancePool pool;
+    pool.SetPoolSize(kBurst);
+    std::vector<FMOD::Studio::EventInstance*> playing;
+    playing.reserve(kBurst);
+
+    double pooledNs = 0.0;
+    for (int round = 0; round <= kRounds; ++round)
+    {
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < kBurst; ++i)
+        {
+            FMOD::Studio::EventInstance* instance = pool.Acquire(description);
+            if (instance != nullptr)
+            {
+                instance->start();
+                playing.push_back(instance);
+            }
+        }
+
+        // The first round only fills the pool
+        if (round > 0)
+        {
+            pooledNs += ElapsedNs(start);
+        }
+
+        for (FMOD::Studio::EventInstance* instance : playing)
+        {
+            instance->stop(FMOD_STUDIO_STOP_IMMEDIATE);
+        }
+        playing.clear();
+        studioSystem->flushCommands();
+        pool.Update();
+    }
+
+    // Release everything before the pool goes out of scope, since it is the instances' callback user data
+    EventInstancePoolStats stats = pool.GetStats();
+    description->releaseAllInstances();
+    studioSystem->flushCommands();
+    pool.Reset();
+
+    double plays = static_cast<double>(kRounds) * kBurst;
+    out << "Instance pool (" << kRounds << " x " << kBurst << " plays of " << eventPath << ")" << std::endl;
+    out << "  create/start/release: " << createNs / plays << " ns/play" << std::endl;
+    out << "  pooled acquire/start: " << pooledNs / plays << " ns/play (" << stats.reuses << " reuses, "
+        << stats.fallbackCreates << " creates)" << std::endl;
+}
+
+void AudioBenchmarks::EmitterFlush(std::ostream& out, const std::string& eventPath)
+{
+    const int kEmitters = 10000;
+    const int kFlushes = 1000;
+
+    FMOD::Studio::EventDescription* description = FindBenchmarkEvent(out, "Emitter flush", eventPath);
+    if (description == nullptr)
+    {
+        return;
+    }
+
+    std::vector<FMOD::Studio::EventInstance*> instances = CreateInstances(description, kEmitters);
+
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> coordinate(-500.0f, 500.0f);
+    EmitterStore store;
+    for (FMOD::Studio::EventInstance* instance : instances)
+    {
+        store.Add(instance, coordinate(rng), coordinate(rng));
+    }
+
+    AudioListenerSet listeners;
+
+    // The first flush sends every emitter; the timed ones should send nothing
+    store.Flush(listeners);
+    EmitterStoreStats before = store.GetStats();
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < kFlushes; ++i)
+    {
+        store.Flush(listeners);
+    }
+    double flushNs = ElapsedNs(start);
+
+    EmitterStoreStats after = store.GetStats();
+    store.Clear();
+    ReleaseInstances(instances);
+
+    out << "Emitter flush (" << after.emitters << " emitters, nothing moved, " << kFlushes << " flushes)" << std::endl;
+    out << "  " << flushNs / kFlushes / 1000.0 << " us/flush, " << (after.attributesSent - before.attributesSent)
+        << " attributes sent" << std::endl;
+}
+
+void AudioBenchmarks::MultiListenerEmitters(std::ostream& out, const std::string& eventPath)
+{
+    const int kEmitters = 5000;
+    const int kListeners = 4;
+    const int kFrames = 1000;
+    const int kMovingFraction = 8;
+
+    FMOD::Studio::EventDescription* description = FindBenchmarkEvent(out, "Multi-listener emitters", eventPath);
+    if (description == nullptr)
+    {
+        return;
+    }
+
+    std::vector<FMOD::Studio::EventInstance*> instances = CreateInstances(description, kEmitters);
+
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> coordinate(-500.0f, 500.0f);
+    EmitterStore store;
+    std::vector<EmitterUpdate> updates;
+    updates.reserve(instances.size());
+    for (FMOD::Studio::EventInstance* instance : instances)
+    {
+        EmitterUpdate update;
+        update.x = coordinate(rng);
+        update.y = coordinate(rng);
+        update.id = store.Add(instance, update.x, update.y);
+        updates.push_back(update);
+    }
+
+    // Split-screen corners
+    AudioListenerSet listeners;
+    listeners.count = kListeners;
+    for (int i = 0; i < kListeners; ++i)
+    {
+        listeners.x[i] = (i % 2 == 0) ? -250.0f : 250.0f;
+        listeners.y[i] = (i < 2) ? -250.0f : 250.0f;
+    }
+
+    store.Flush(listeners);
+    FMOD::Studio::System* studioSystem = FMODAudioSystem::GetInstance().GetStudioSystem();
+    studioSystem->flushCommands();
+    EmitterStoreStats before = store.GetStats();
+
+    double frameNs = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame)
+    {
+        // A different eighth moves each frame; the rest resubmit their old position
+        for (size_t i = frame % kMovingFraction; i < updates.size(); i += kMovingFraction)
+        {
+            updates[i].vx = (frame % 2 == 0) ? 1.0f : -1.0f;
+            updates[i].x += updates[i].vx;
+        }
+
+        Clock::time_point start = Clock::now();
+        store.UpdateEmitters(updates);
+        store.Flush(listeners);
+        frameNs += ElapsedNs(start);
+
+        // Stands in for the Studio update that follows each flush
+        studioSystem->flushCommands();
+    }
+
+    EmitterStoreStats after = store.GetStats();
+    store.Clear();
+    ReleaseInstances(instances);
+
+    out << "Multi-listener emitters (" << after.emitters << " emitters, " << kListeners << " listeners, "
+        << kFrames << " frames)" << std::endl;
+    out << "  UpdateEmitters + Flush: " << frameNs / kFrames / 1000.0 << " us/frame, "
+        << static_cast<double>(after.attributesSent - before.attributesSent) / kFrames << " attributes sent/frame" << std::endl;
+}
@@ -0,0 +1,51 @@
+// AudioBenchmarks.h - Timing runs for the wrapper's hot paths
+#pragma once
+
+#include <ostream>
+#include <string>
+
+// Micro-benchmarks for the subsystems whose per-frame cost the wrapper is meant to
+// bound. main.cpp runs them with "--benchmark [eventPath]". Benchmarks that need real
+// event instances are skipped unless FMOD is initialized and an event path is given.
+class AudioBenchmarks
+{
+public:
+    static void RunAll(std::ostream& out, const std::string& eventPath = "");
+
+    // Pool allocator vs. malloc/free over FMOD's small-block size mix, 1-8 threads.
+    // The allocator's stats include this traffic afterwards.
+    static void Allocator(std::ostream& out);
+
+    // 8 producer threads posting into an AudioCommandQueue drained by one consumer:
+    // post cost, throughput and post-to-drain latency, flat out and paced
+    static void CommandQueue(std::ostream& out);
+
+    // SpatialHashGrid radius queries against a brute-force scan at 1k, 10k and 100k
+    // IDs over a fixed area; the results are checked to match
+    static void SpatialGrid(std::ostream& out);
+
+    // OcclusionGeometry BVH traces against testing every wall, 5k walls and 2000
+    // traces; the results are checked to match
+    static void OcclusionBvh(std::ostream& out);
+
+    // AudioEventSlotMap insert/erase churn (5000 records, 100 rounds, shuffled erase
+    // order) against an unordered_map keyed by a counter, plus stale-handle checks
+    static void EventSlotMap(std::ostream& out);
+
+    // The lifetime-notice drain CleanupEvents does per tick: 5000 live records, 20
+    // ending per tick, notices posted from a second thread. Compared against visiting
+    // every live record, which is what per-event polling cost before the ring.
+    static void LifetimeNotices(std::ostream& out);
+
+    // PlayOneShot's create/start/release against EventInstancePool's acquire/start,
+    // in bursts of 64 plays of eventPath. Needs FMOD initialized.
+    static void InstancePool(std::ostream& out, const std::string& eventPath);
+
+    // EmitterStore::Flush over 10k emitters (unstarted instances of eventPath) when
+    // nothing has moved since the last flush. Needs FMOD initialized.
+    static void EmitterFlush(std::ostream& out, const std::string& eventPath);
+
+    // A frame of UpdateEmitters plus Flush for 5k emitters and 4 listeners, with an
+    // eighth of the emitters moving each frame. Needs FMOD initialized.
+    static void MultiListenerEmitters(std::ostream& out, const std::string& eventPath);
+};
@@ -0,0 +1,17 @@
+// AudioCacheStats.h - Hit/miss counters shared by the audio wrapper's caches
+#pragma once
+
+#include <cstdint>
+
+struct AudioCacheStats
+{
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    float GetHitRate() const
+    {
+        uint64_t total = hits + misses;
+        return (total > 0) ? static_cast<float>(hits) / static_cast<float>(total) : 0.0f;
+    }
+};
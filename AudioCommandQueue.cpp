@@ -0,0 +1,12 @@
+// AudioCommandQueue.cpp
+#include "AudioCommandQueue.h"
+#include <algorithm>
+#include <cstring>
+
+bool AudioCommand::SetName(const char* text, size_t length)
+{
+    size_t copied = std::min(length, kMaxNameLength);
+    std::memcpy(name, text, copied);
+    name[copied] = '\0';
+    return copied == length;
+}
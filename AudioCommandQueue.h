@@ -0,0 +1,47 @@
+// AudioCommandQueue.h - Lock-free multi-producer single-consumer command ring
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "MpscRing.h"
+
+enum class AudioCommandType : uint8_t
+{
+    PlayOneShot,
+    SetEventParameter,
+    SetEventParameterById,
+    SetGlobalParameter,
+    SetGlobalParameterById,
+    SetEventPosition,
+    SetListenerPosition,
+    StartEvent,
+    StopEvent,
+    SetEventPaused,
+    SetEventVolume
+};
+
+// Fixed-size, trivially copyable command. Strings (event paths, parameter names)
+// are copied into 'name' so the poster's buffers don't need to outlive the post.
+struct AudioCommand
+{
+    static const size_t kMaxNameLength = 95;
+
+    AudioCommandType type = AudioCommandType::PlayOneShot;
+    FMOD::Studio::EventInstance* instance = nullptr;
+    FMOD_STUDIO_PARAMETER_ID parameterId = {};
+    float x = 0.0f;
+    float y = 0.0f;
+    float value = 0.0f;
+    int listener = 0;
+    bool flag = false; // Fade-out for StopEvent, pause state for SetEventPaused
+    std::chrono::steady_clock::time_point postTime;
+    char name[kMaxNameLength + 1] = {};
+
+    // Copies at most kMaxNameLength characters; returns false if it had to truncate
+    bool SetName(const char* text, size_t length);
+};
+
+// Commands posted to the audio thread from any number of game threads
+using AudioCommandQueue = MpscRing<AudioCommand>;
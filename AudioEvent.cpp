@@ -1,44 +1,61 @@
 // AudioEvent.cpp
 #include "AudioEvent.h"
+#include "GameAudioManager.h"
 
 AudioEvent::AudioEvent(const std::string& eventPath)
-    : m_EventPath(eventPath)
+    : AudioEvent(GameAudioManager::GetInstance().CreateEventHandle(AudioEventId(eventPath)))
 {
-    m_EventInstance = FMODAudioSystem::GetInstance().CreateEventInstance(eventPath);
-    m_IsValid = (m_EventInstance != nullptr);
+}
+
+AudioEvent::AudioEvent(AudioEventHandle handle)
+    : m_Handle(handle)
+{
+    m_EventInstance = GameAudioManager::GetInstance().GetEventInstance(handle);
 }
 
 AudioEvent::~AudioEvent()
 {
-    if (m_IsValid && m_EventInstance)
+    if (m_EventInstance)
     {
-        // Stop immediately (no fade out)
+        // Stop immediately (no fade out); handle users who want a dropped event to
+        // play out release the handle instead
         Stop(false);
 
-        // Release the event instance
-        FMODAudioSystem::GetInstance().ReleaseEvent(m_EventInstance);
+        GameAudioManager::GetInstance().ReleaseEventHandle(m_Handle);
         m_EventInstance = nullptr;
     }
 }
 
 bool AudioEvent::Play()
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostStartEvent(m_EventInstance);
+    }
+
     FMOD_RESULT result = m_EventInstance->start();
     return (result == FMOD_OK);
 }
 
 bool AudioEvent::Stop(bool allowFadeOut)
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostStopEvent(m_EventInstance, allowFadeOut);
+    }
+
     FMOD_STUDIO_STOP_MODE mode = allowFadeOut ? FMOD_STUDIO_STOP_ALLOWFADEOUT : FMOD_STUDIO_STOP_IMMEDIATE;
     FMOD_RESULT result = m_EventInstance->stop(mode);
     return (result == FMOD_OK);
@@ -46,33 +63,46 @@ bool AudioEvent::Stop(bool allowFadeOut)
 
 bool AudioEvent::Pause(bool pause)
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostSetEventPaused(m_EventInstance, pause);
+    }
+
     FMOD_RESULT result = m_EventInstance->setPaused(pause);
     return (result == FMOD_OK);
 }
 
 bool AudioEvent::Resume(bool pause)
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostSetEventPaused(m_EventInstance, pause);
+    }
+
     FMOD_RESULT result = m_EventInstance->setPaused(pause);
     return (result == FMOD_OK);
 }
 
 bool AudioEvent::IsPaused() const
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    auto lock = GameAudioManager::GetInstance().LockAudio();
     bool paused = false;
     FMOD_RESULT result = m_EventInstance->getPaused(&paused);
     return (result == FMOD_OK) && paused;
@@ -80,52 +110,122 @@ bool AudioEvent::IsPaused() const
 
 void AudioEvent::SetPosition(float x, float y)
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        audioThread.PostSetEventPosition(m_EventInstance, x, y);
+        return;
+    }
+
     FMODAudioSystem::GetInstance().Set3DEventPosition(m_EventInstance, x, y);
 }
 
 bool AudioEvent::SetParameter(const std::string& name, float value)
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostSetEventParameter(m_EventInstance, name, value);
+    }
+
     return FMODAudioSystem::GetInstance().SetEventParameter(m_EventInstance, name, value);
 }
 
 float AudioEvent::GetParameter(const std::string& name) const
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return 0.0f;
     }
 
+    auto lock = GameAudioManager::GetInstance().LockAudio();
     return FMODAudioSystem::GetInstance().GetEventParameter(m_EventInstance, name);
 }
 
+bool AudioEvent::GetParameterId(const std::string& name, FMOD_STUDIO_PARAMETER_ID& parameterId) const
+{
+    if (!m_EventInstance)
+    {
+        return false;
+    }
+
+    auto lock = GameAudioManager::GetInstance().LockAudio();
+    return FMODAudioSystem::GetInstance().GetEventParameterId(m_EventInstance, name, parameterId);
+}
+
+bool AudioEvent::SetParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value)
+{
+    if (!m_EventInstance)
+    {
+        return false;
+    }
+
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostSetEventParameterById(m_EventInstance, parameterId, value);
+    }
+
+    return FMODAudioSystem::GetInstance().SetEventParameterById(m_EventInstance, parameterId, value);
+}
+
+float AudioEvent::GetParameterById(FMOD_STUDIO_PARAMETER_ID parameterId) const
+{
+    if (!m_EventInstance)
+    {
+        return 0.0f;
+    }
+
+    auto lock = GameAudioManager::GetInstance().LockAudio();
+    return FMODAudioSystem::GetInstance().GetEventParameterById(m_EventInstance, parameterId);
+}
+
+bool AudioEvent::SetParametersByIds(const FMOD_STUDIO_PARAMETER_ID* parameterIds, float* values, int count)
+{
+    if (!m_EventInstance)
+    {
+        return false;
+    }
+
+    auto lock = GameAudioManager::GetInstance().LockAudio();
+    return FMODAudioSystem::GetInstance().SetEventParametersByIds(m_EventInstance, parameterIds, values, count);
+}
+
 bool AudioEvent::SetVolume(float volume)
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    AudioThread& audioThread = GameAudioManager::GetInstance().GetAudioThread();
+    if (audioThread.IsRunning())
+    {
+        return audioThread.PostSetEventVolume(m_EventInstance, volume);
+    }
+
     FMOD_RESULT result = m_EventInstance->setVolume(volume);
     return (result == FMOD_OK);
 }
 
 float AudioEvent::GetVolume() const
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return 0.0f;
     }
 
+    auto lock = GameAudioManager::GetInstance().LockAudio();
     float volume = 0.0f;
     FMOD_RESULT result = m_EventInstance->getVolume(&volume);
     return (result == FMOD_OK) ? volume : 0.0f;
@@ -133,11 +233,12 @@ float AudioEvent::GetVolume() const
 
 bool AudioEvent::IsPlaying() const
 {
-    if (!m_IsValid || !m_EventInstance)
+    if (!m_EventInstance)
     {
         return false;
     }
 
+    auto lock = GameAudioManager::GetInstance().LockAudio();
     FMOD_STUDIO_PLAYBACK_STATE state;
     FMOD_RESULT result = m_EventInstance->getPlaybackState(&state);
     
@@ -146,5 +247,6 @@ bool AudioEvent::IsPlaying() const
 
 bool AudioEvent::IsValid() const
 {
-    return m_IsValid && (m_EventInstance != nullptr);
+    // The handle goes stale when a Restart takes the instance with it
+    return m_EventInstance != nullptr && GameAudioManager::GetInstance().IsEventHandleValid(m_Handle);
 }
@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "FMODAudioSystem.h"
+#include "AudioEventSlotMap.h"
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -16,13 +17,22 @@ namespace FMOD
     }
 }
 
-// A higher-level wrapper for FMOD event instances
+// A higher-level wrapper for FMOD event instances. Adapts a slot-map handle owned by
+// GameAudioManager to shared_ptr-based callers; destroying it stops the event
+// immediately and releases the handle, which takes the audio lock.
+// In audio-thread mode every setter (playback, position, parameters, volume) is
+// posted to the audio thread and returns whether the post succeeded, and getters
+// take the audio lock, so don't call them while already holding it.
 class AudioEvent
 {
 public:
     AudioEvent(const std::string& eventPath);
+    explicit AudioEvent(AudioEventHandle handle); // Takes over a handle from CreateEventHandle
     ~AudioEvent();
 
+    AudioEvent(const AudioEvent&) = delete;
+    AudioEvent& operator=(const AudioEvent&) = delete;
+
     // Basic playback control
     bool Play();
     bool Stop(bool allowFadeOut = true);
@@ -37,6 +47,12 @@ public:
     bool SetParameter(const std::string& name, float value);
     float GetParameter(const std::string& name) const;
 
+    // Parameter control by cached ID (resolve the ID once, then set it every frame)
+    bool GetParameterId(const std::string& name, FMOD_STUDIO_PARAMETER_ID& parameterId) const;
+    bool SetParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value);
+    float GetParameterById(FMOD_STUDIO_PARAMETER_ID parameterId) const;
+    bool SetParametersByIds(const FMOD_STUDIO_PARAMETER_ID* parameterIds, float* values, int count);
+
     // Volume control
     bool SetVolume(float volume);
     float GetVolume() const;
@@ -47,9 +63,9 @@ public:
 
     // Get the raw FMOD event instance (use carefully)
     FMOD::Studio::EventInstance* GetRawEventInstance() const { return m_EventInstance; }
+    AudioEventHandle GetHandle() const { return m_Handle; }
 
 private:
-    FMOD::Studio::EventInstance* m_EventInstance = nullptr;
-    std::string m_EventPath;
-    bool m_IsValid = false;
+    AudioEventHandle m_Handle = kInvalidAudioEventHandle;
+    FMOD::Studio::EventInstance* m_EventInstance = nullptr; // Cached from the record
 };
\ No newline at end of file
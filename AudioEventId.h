@@ -0,0 +1,46 @@
+// AudioEventId.h - Compile-time hashed identifiers for FMOD Studio paths
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// 64-bit FNV-1a hash of an FMOD Studio path ("event:/...", "bus:/...", ...)
+constexpr uint64_t HashAudioPath(std::string_view path)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : path)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Identifies an event by the hash of its path. The path view is only used to
+// resolve the event description the first time the id is seen, so it must stay
+// valid for the duration of the call (string literals always do).
+struct AudioEventId
+{
+    uint64_t hash = 0;
+    std::string_view path;
+
+    constexpr AudioEventId() = default;
+    constexpr explicit AudioEventId(std::string_view eventPath)
+        : hash(HashAudioPath(eventPath)), path(eventPath)
+    {
+    }
+    explicit AudioEventId(const std::string& eventPath)
+        : AudioEventId(std::string_view(eventPath))
+    {
+    }
+
+    constexpr bool IsValid() const { return !path.empty(); }
+};
+
+// Usage: PlayOneShot("event:/SFX/PlayerJump"_event, position);
+constexpr AudioEventId operator""_event(const char* path, size_t length)
+{
+    return AudioEventId(std::string_view(path, length));
+}
@@ -0,0 +1,115 @@
+// AudioEventSlotMap.cpp
+#include "AudioEventSlotMap.h"
+
+namespace
+{
+    uint32_t HandleIndex(AudioEventHandle handle) { return static_cast<uint32_t>(handle); }
+    uint32_t HandleGeneration(AudioEventHandle handle) { return static_cast<uint32_t>(handle >> 32); }
+}
+
+void AudioEventSlotMap::Reserve(size_t capacity)
+{
+    m_Slots.reserve(capacity);
+    m_FreeList.reserve(capacity);
+}
+
+uint32_t AudioEventSlotMap::InternPath(AudioEventId eventId)
+{
+    if (const uint32_t* pathId = m_PathIds.Find(eventId.hash))
+    {
+        return *pathId;
+    }
+
+    uint32_t pathId = static_cast<uint32_t>(m_Paths.size());
+    m_Paths.emplace_back(eventId.path);
+    m_PathIds.Insert(eventId.hash, pathId);
+    return pathId;
+}
+
+AudioEventHandle AudioEventSlotMap::Insert(FMOD::Studio::EventInstance* instance, AudioEventId eventId, uint8_t flags)
+{
+    uint32_t index;
+    if (!m_FreeList.empty())
+    {
+        index = m_FreeList.back();
+        m_FreeList.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.emplace_back();
+        m_FreeList.reserve(m_Slots.capacity());
+    }
+
+    AudioEventRecord& record = m_Slots[index];
+    record.instance = instance;
+    record.pathId = InternPath(eventId);
+    record.flags = flags;
+    return (static_cast<AudioEventHandle>(record.generation) << 32) | index;
+}
+
+void AudioEventSlotMap::Erase(AudioEventHandle handle)
+{
+    AudioEventRecord* record = Get(handle);
+    if (record == nullptr)
+    {
+        return;
+    }
+
+    record->instance = nullptr;
+    record->flags = 0;
+
+    // Skip 0 on wrap-around so a live handle is never kInvalidAudioEventHandle
+    if (++record->generation == 0)
+    {
+        record->generation = 1;
+    }
+
+    m_FreeList.push_back(HandleIndex(handle));
+}
+
+AudioEventRecord* AudioEventSlotMap::Get(AudioEventHandle handle)
+{
+    uint32_t index = HandleIndex(handle);
+    if (index >= m_Slots.size())
+    {
+        return nullptr;
+    }
+
+    AudioEventRecord& record = m_Slots[index];
+    return (record.generation == HandleGeneration(handle) && record.instance != nullptr) ? &record : nullptr;
+}
+
+const AudioEventRecord* AudioEventSlotMap::Get(AudioEventHandle handle) const
+{
+    return const_cast<AudioEventSlotMap*>(this)->Get(handle);
+}
+
+AudioEventHandle AudioEventSlotMap::HandleAt(uint32_t index) const
+{
+    if (index >= m_Slots.size() || m_Slots[index].instance == nullptr)
+    {
+        return kInvalidAudioEventHandle;
+    }
+
+    return (static_cast<AudioEventHandle>(m_Slots[index].generation) << 32) | index;
+}
+
+void AudioEventSlotMap::Clear()
+{
+    m_FreeList.clear();
+    for (uint32_t index = 0; index < m_Slots.size(); ++index)
+    {
+        AudioEventRecord& record = m_Slots[index];
+        if (record.instance != nullptr)
+        {
+            record.instance = nullptr;
+            record.flags = 0;
+            if (++record.generation == 0)
+            {
+                record.generation = 1;
+            }
+        }
+        m_FreeList.push_back(index);
+    }
+}
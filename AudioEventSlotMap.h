@@ -0,0 +1,67 @@
+// AudioEventSlotMap.h - Generational slot map of compact event records
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "AudioEventId.h"
+#include "HashedHandleTable.h"
+
+// Index in the low 32 bits, slot generation in the high 32. Generations start at 1,
+// so 0 is never a live handle.
+using AudioEventHandle = uint64_t;
+constexpr AudioEventHandle kInvalidAudioEventHandle = 0;
+
+enum AudioEventFlags : uint8_t
+{
+    kAudioEventOwned = 1 << 0, // The creator still holds the handle (not yet released)
+};
+
+struct AudioEventRecord
+{
+    FMOD::Studio::EventInstance* instance = nullptr;
+    uint32_t pathId = 0;     // Index into the interned path table
+    uint32_t generation = 1; // Bumped each time the slot is freed
+    uint8_t flags = 0;
+};
+
+// Event records in one contiguous array addressed by generational handles. Insert
+// and Erase are O(1) and reuse freed slots, so nothing is allocated once the array
+// has grown to the peak event count (or was reserved up front). A handle whose slot
+// has since been freed or reused fails the generation check in Get. Event paths are
+// interned once per unique path and records refer to them by index.
+class AudioEventSlotMap
+{
+public:
+    void Reserve(size_t capacity);
+
+    AudioEventHandle Insert(FMOD::Studio::EventInstance* instance, AudioEventId eventId, uint8_t flags);
+    void Erase(AudioEventHandle handle);
+
+    // Null for a stale or invalid handle
+    AudioEventRecord* Get(AudioEventHandle handle);
+    const AudioEventRecord* Get(AudioEventHandle handle) const;
+
+    // The live handle in a slot, or kInvalidAudioEventHandle if the slot is free
+    AudioEventHandle HandleAt(uint32_t index) const;
+    static uint32_t IndexOf(AudioEventHandle handle) { return static_cast<uint32_t>(handle); }
+
+    const std::string& GetPath(uint32_t pathId) const { return m_Paths[pathId]; }
+
+    // Frees every slot, so all outstanding handles go stale; interned paths are kept
+    void Clear();
+
+    size_t Size() const { return m_Slots.size() - m_FreeList.size(); }
+    size_t Capacity() const { return m_Slots.size(); }
+
+private:
+    uint32_t InternPath(AudioEventId eventId);
+
+    std::vector<AudioEventRecord> m_Slots;
+    std::vector<uint32_t> m_FreeList;
+
+    std::vector<std::string> m_Paths;
+    HashedHandleTable<uint32_t> m_PathIds;
+};
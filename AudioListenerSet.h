@@ -0,0 +1,30 @@
+// AudioListenerSet.h - Packed positions of the listeners that culling should consider
+#pragma once
+
+#include <fmod_common.h>
+
+// Positions of the active listeners (weight above zero) as parallel arrays, so
+// distance loops can run over them without gathering. Always holds at least one
+// listener. Listeners sit on the z = 0 plane like the rest of the 2D wrapper.
+struct AudioListenerSet
+{
+    int count = 1;
+    float x[FMOD_MAX_LISTENERS] = {};
+    float y[FMOD_MAX_LISTENERS] = {};
+
+    float NearestDistanceSquared(float px, float py, float pz = 0.0f) const
+    {
+        float nearest = 0.0f;
+        for (int i = 0; i < count; ++i)
+        {
+            float dx = px - x[i];
+            float dy = py - y[i];
+            float distanceSquared = dx * dx + dy * dy + pz * pz;
+            if (i == 0 || distanceSquared < nearest)
+            {
+                nearest = distanceSquared;
+            }
+        }
+        return nearest;
+    }
+};
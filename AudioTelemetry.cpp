@@ -0,0 +1,269 @@
+// AudioTelemetry.cpp
+#include "AudioTelemetry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    float GetMetric(const AudioTelemetrySample& sample, AudioTelemetryMetric metric)
+    {
+        switch (metric)
+        {
+        case AudioTelemetryMetric::DspCpu:          return sample.dspCpu;
+        case AudioTelemetryMetric::StreamCpu:       return sample.streamCpu;
+        case AudioTelemetryMetric::GeometryCpu:     return sample.geometryCpu;
+        case AudioTelemetryMetric::UpdateCpu:       return sample.updateCpu;
+        case AudioTelemetryMetric::ConvolutionCpu:  return sample.convolutionCpu;
+        case AudioTelemetryMetric::StudioCpu:       return sample.studioCpu;
+        case AudioTelemetryMetric::AllocatedBytes:  return static_cast<float>(sample.allocatedBytes);
+        case AudioTelemetryMetric::ChannelsPlaying: return static_cast<float>(sample.channelsPlaying);
+        case AudioTelemetryMetric::RealChannels:    return static_cast<float>(sample.realChannels);
+        case AudioTelemetryMetric::EventInstances:  return static_cast<float>(sample.eventInstances);
+        }
+        return 0.0f;
+    }
+}
+
+AudioTelemetry::AudioTelemetry(size_t capacity)
+    : m_Slots(new Slot[capacity > 0 ? capacity : 1])
+    , m_Capacity(capacity > 0 ? capacity : 1)
+{
+    m_StartTime = std::chrono::steady_clock::now();
+    m_NextSample = m_StartTime;
+}
+
+void AudioTelemetry::SetEnabled(bool enabled, float intervalSeconds)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (enabled && !m_Enabled)
+    {
+        m_StartTime = now;
+    }
+
+    m_Enabled = enabled;
+    m_Interval = std::chrono::duration<double>(std::max(intervalSeconds, 0.0f));
+    m_NextSample = now;
+}
+
+void AudioTelemetry::Update(FMOD::Studio::System* studioSystem, FMOD::System* coreSystem, HashedHandleTable<FMOD::Studio::EventDescription*>& descriptions)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!m_Enabled || now < m_NextSample)
+    {
+        return;
+    }
+
+    m_NextSample += std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_Interval);
+    if (m_NextSample < now)
+    {
+        m_NextSample = now;
+    }
+
+    Sample(studioSystem, coreSystem, descriptions);
+}
+
+void AudioTelemetry::Sample(FMOD::Studio::System* studioSystem, FMOD::System* coreSystem, HashedHandleTable<FMOD::Studio::EventDescription*>& descriptions)
+{
+    AudioTelemetrySample sample;
+    sample.timeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+
+    // The Studio call reports the core system's usage as well
+    FMOD_STUDIO_CPU_USAGE studioUsage = {};
+    FMOD_CPU_USAGE coreUsage = {};
+    if (studioSystem->getCPUUsage(&studioUsage, &coreUsage) == FMOD_OK)
+    {
+        sample.dspCpu = coreUsage.dsp;
+        sample.streamCpu = coreUsage.stream;
+        sample.geometryCpu = coreUsage.geometry;
+        sample.updateCpu = coreUsage.update;
+        sample.convolutionCpu = coreUsage.convolution1 + coreUsage.convolution2;
+        sample.studioCpu = studioUsage.update;
+    }
+
+    // Non-blocking: the figures may be a moment stale but the sampler never waits
+    FMOD::Memory_GetStats(&sample.allocatedBytes, &sample.maxAllocatedBytes, false);
+    coreSystem->getChannelsPlaying(&sample.channelsPlaying, &sample.realChannels);
+
+    m_Counts.clear();
+    bool newNames = false;
+    descriptions.ForEach([&](uint64_t pathHash, FMOD::Studio::EventDescription* description)
+    {
+        int count = 0;
+        if (description->getInstanceCount(&count) != FMOD_OK || count == 0)
+        {
+            return;
+        }
+
+        sample.eventInstances += count;
+        m_Counts.push_back({ pathHash, count });
+
+        if (m_EventNames.find(pathHash) == m_EventNames.end())
+        {
+            char path[256] = {};
+            description->getPath(path, sizeof(path), nullptr);
+            m_EventNames.emplace(pathHash, path);
+            newNames = true;
+        }
+    });
+
+    // Copy-on-write: readers keep whichever snapshot they loaded
+    if (newNames)
+    {
+        m_PublishedNames.store(std::make_shared<const EventNames>(m_EventNames), std::memory_order_release);
+    }
+
+    size_t top = std::min(m_Counts.size(), static_cast<size_t>(AudioTelemetrySample::kTopEvents));
+    std::partial_sort(m_Counts.begin(), m_Counts.begin() + top, m_Counts.end(),
+        [](const AudioTelemetryEventCount& a, const AudioTelemetryEventCount& b) { return a.instances > b.instances; });
+    std::copy(m_Counts.begin(), m_Counts.begin() + top, sample.topEvents);
+
+    Push(sample);
+}
+
+void AudioTelemetry::Push(const AudioTelemetrySample& sample)
+{
+    uint64_t index = m_Written.load(std::memory_order_relaxed);
+    Slot& slot = m_Slots[index % m_Capacity];
+
+    uint64_t words[kSampleWords] = {};
+    std::memcpy(words, &sample, sizeof(sample));
+
+    // Odd sequence marks the slot as mid-write for readers
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < kSampleWords; ++i)
+    {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    m_Written.store(index + 1, std::memory_order_release);
+}
+
+size_t AudioTelemetry::CopySamples(std::vector<AudioTelemetrySample>& samples, size_t maxSamples) const
+{
+    uint64_t written = m_Written.load(std::memory_order_acquire);
+    uint64_t available = std::min<uint64_t>(written, m_Capacity);
+    if (maxSamples > 0)
+    {
+        available = std::min<uint64_t>(available, maxSamples);
+    }
+
+    size_t copied = 0;
+    for (uint64_t index = written - available; index < written; ++index)
+    {
+        const Slot& slot = m_Slots[index % m_Capacity];
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            continue;
+        }
+
+        // Relaxed atomic reads may see a torn mix of two samples; the sequence
+        // check below throws those away before they are interpreted
+        uint64_t words[kSampleWords];
+        for (size_t i = 0; i < kSampleWords; ++i)
+        {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != before)
+        {
+            continue;
+        }
+
+        AudioTelemetrySample sample;
+        std::memcpy(&sample, words, sizeof(sample));
+        samples.push_back(sample);
+        ++copied;
+    }
+
+    return copied;
+}
+
+AudioTelemetrySummary AudioTelemetry::GetSummary(AudioTelemetryMetric metric, size_t windowSamples) const
+{
+    std::vector<AudioTelemetrySample> samples;
+    CopySamples(samples, windowSamples);
+
+    AudioTelemetrySummary summary;
+    if (samples.empty())
+    {
+        return summary;
+    }
+
+    std::vector<float> values;
+    values.reserve(samples.size());
+    double total = 0.0;
+    for (const AudioTelemetrySample& sample : samples)
+    {
+        float value = GetMetric(sample, metric);
+        values.push_back(value);
+        total += value;
+    }
+
+    summary.samples = static_cast<int>(values.size());
+    summary.min = *std::min_element(values.begin(), values.end());
+    summary.average = static_cast<float>(total / static_cast<double>(values.size()));
+
+    // Nearest-rank p99
+    size_t rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(values.size()))) - 1;
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    summary.p99 = values[rank];
+    return summary;
+}
+
+std::string AudioTelemetry::GetEventName(const EventNames* names, uint64_t pathHash)
+{
+    if (names != nullptr)
+    {
+        auto it = names->find(pathHash);
+        if (it != names->end() && !it->second.empty())
+        {
+            return it->second;
+        }
+    }
+
+    return std::to_string(pathHash);
+}
+
+bool AudioTelemetry::DumpToFile(const std::string& path) const
+{
+    std::vector<AudioTelemetrySample> samples;
+    CopySamples(samples);
+    std::shared_ptr<const EventNames> names = m_PublishedNames.load(std::memory_order_acquire);
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "FMOD: Failed to open telemetry dump '" << path << "'" << std::endl;
+        return false;
+    }
+
+    file << "time_s,dsp_cpu,stream_cpu,geometry_cpu,update_cpu,convolution_cpu,studio_cpu,"
+         << "allocated_bytes,max_allocated_bytes,channels_playing,real_channels,event_instances,top_events" << std::endl;
+
+    for (const AudioTelemetrySample& sample : samples)
+    {
+        file << sample.timeSeconds << ',' << sample.dspCpu << ',' << sample.streamCpu << ',' << sample.geometryCpu << ','
+             << sample.updateCpu << ',' << sample.convolutionCpu << ',' << sample.studioCpu << ','
+             << sample.allocatedBytes << ',' << sample.maxAllocatedBytes << ','
+             << sample.channelsPlaying << ',' << sample.realChannels << ',' << sample.eventInstances << ',';
+
+        // "event:/a=3;event:/b=1", quoted since paths may contain commas
+        file << '"';
+        for (int i = 0; i < AudioTelemetrySample::kTopEvents && sample.topEvents[i].instances > 0; ++i)
+        {
+            file << (i > 0 ? ";" : "") << GetEventName(names.get(), sample.topEvents[i].pathHash) << '=' << sample.topEvents[i].instances;
+        }
+        file << '"' << std::endl;
+    }
+
+    return static_cast<bool>(file);
+}
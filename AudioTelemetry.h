@@ -0,0 +1,124 @@
+// AudioTelemetry.h - Rolling engine cost samples (CPU, memory, voices, instances)
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <fmod.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "HashedHandleTable.h"
+
+// An event description and how many instances of it existed at sample time
+struct AudioTelemetryEventCount
+{
+    uint64_t pathHash = 0;
+    int instances = 0;
+};
+
+// One fixed-size sample. CPU figures are percentages as reported by FMOD.
+struct AudioTelemetrySample
+{
+    static const int kTopEvents = 8;
+
+    double timeSeconds = 0.0; // Since telemetry was last enabled
+    float dspCpu = 0.0f;
+    float streamCpu = 0.0f;
+    float geometryCpu = 0.0f;
+    float updateCpu = 0.0f;
+    float convolutionCpu = 0.0f; // Both convolution threads
+    float studioCpu = 0.0f;
+    int allocatedBytes = 0;
+    int maxAllocatedBytes = 0;
+    int channelsPlaying = 0;
+    int realChannels = 0;
+    int eventInstances = 0; // Across every event the wrapper has resolved
+    AudioTelemetryEventCount topEvents[kTopEvents]; // Most instances first
+};
+
+enum class AudioTelemetryMetric
+{
+    DspCpu,
+    StreamCpu,
+    GeometryCpu,
+    UpdateCpu,
+    ConvolutionCpu,
+    StudioCpu,
+    AllocatedBytes,
+    ChannelsPlaying,
+    RealChannels,
+    EventInstances
+};
+
+struct AudioTelemetrySummary
+{
+    int samples = 0;
+    float min = 0.0f;
+    float average = 0.0f;
+    float p99 = 0.0f;
+};
+
+// Samples FMOD's cost counters at a fixed interval into a ring of fixed-size
+// samples. Sampling happens on whichever thread runs FMODAudioSystem::Update; each
+// ring slot is guarded by a sequence counter (a seqlock) and holds its sample as
+// relaxed atomic words, so summaries and dumps can be read from any thread without
+// locking or stalling the sampler. A slot that is being overwritten while it is
+// read is skipped. Event names for dumps are published as an immutable snapshot
+// that is only rebuilt when the sampler sees a new event.
+class AudioTelemetry
+{
+public:
+    explicit AudioTelemetry(size_t capacity = 600);
+
+    // Enabling after being disabled restarts the sample clock at zero
+    void SetEnabled(bool enabled, float intervalSeconds = 0.1f);
+    bool IsEnabled() const { return m_Enabled; }
+
+    // Takes a sample if the interval has passed; call from FMODAudioSystem::Update
+    void Update(FMOD::Studio::System* studioSystem, FMOD::System* coreSystem, HashedHandleTable<FMOD::Studio::EventDescription*>& descriptions);
+
+    // Appends up to maxSamples of the newest samples (0 = all), oldest first
+    size_t CopySamples(std::vector<AudioTelemetrySample>& samples, size_t maxSamples = 0) const;
+
+    // Min/average/p99 of one metric over the newest windowSamples (0 = whole ring)
+    AudioTelemetrySummary GetSummary(AudioTelemetryMetric metric, size_t windowSamples = 0) const;
+
+    // Writes every sample in the ring as CSV
+    bool DumpToFile(const std::string& path) const;
+
+private:
+    static_assert(std::is_trivially_copyable_v<AudioTelemetrySample>, "Samples are copied word by word");
+    static constexpr size_t kSampleWords = (sizeof(AudioTelemetrySample) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence{ 0 }; // Odd while being written
+        std::atomic<uint64_t> words[kSampleWords] = {};
+    };
+
+    using EventNames = std::unordered_map<uint64_t, std::string>;
+
+    void Sample(FMOD::Studio::System* studioSystem, FMOD::System* coreSystem, HashedHandleTable<FMOD::Studio::EventDescription*>& descriptions);
+    void Push(const AudioTelemetrySample& sample);
+    static std::string GetEventName(const EventNames* names, uint64_t pathHash);
+
+    std::unique_ptr<Slot[]> m_Slots;
+    size_t m_Capacity = 0;
+    std::atomic<uint64_t> m_Written{ 0 };
+
+    bool m_Enabled = true;
+    std::chrono::duration<double> m_Interval{ 0.1 };
+    std::chrono::steady_clock::time_point m_StartTime;
+    std::chrono::steady_clock::time_point m_NextSample;
+
+    // Event paths for dumps, resolved once per description by the sampler. The
+    // sampler owns m_EventNames; readers only see the published copy.
+    EventNames m_EventNames;
+    std::atomic<std::shared_ptr<const EventNames>> m_PublishedNames;
+    std::vector<AudioTelemetryEventCount> m_Counts;
+};
@@ -0,0 +1,267 @@
+// AudioThread.cpp
+#include "AudioThread.h"
+#include "FMODAudioSystem.h"
+#include <iostream>
+
+AudioThread::~AudioThread()
+{
+    Stop();
+}
+
+bool AudioThread::Start(AudioTickScheduler* scheduler)
+{
+    if (IsRunning() || scheduler == nullptr)
+    {
+        return false;
+    }
+
+    m_Scheduler = scheduler;
+    m_Running.store(true, std::memory_order_release);
+    m_Thread = std::thread(&AudioThread::Run, this);
+    return true;
+}
+
+void AudioThread::Stop()
+{
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    m_Running.store(false, std::memory_order_release);
+    m_Thread.join();
+}
+
+bool AudioThread::PostPlayOneShot(AudioEventId eventId, float x, float y)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::PlayOneShot;
+    command.x = x;
+    command.y = y;
+    if (!command.SetName(eventId.path.data(), eventId.path.size()))
+    {
+        std::cerr << "FMOD: Event path too long to post: " << eventId.path << std::endl;
+        return false;
+    }
+    return Post(command);
+}
+
+bool AudioThread::PostSetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& name, float value)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetEventParameter;
+    command.instance = eventInstance;
+    command.value = value;
+    if (!command.SetName(name.c_str(), name.size()))
+    {
+        std::cerr << "FMOD: Parameter name too long to post: " << name << std::endl;
+        return false;
+    }
+    return Post(command);
+}
+
+bool AudioThread::PostSetEventParameterById(FMOD::Studio::EventInstance* eventInstance, FMOD_STUDIO_PARAMETER_ID parameterId, float value)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetEventParameterById;
+    command.instance = eventInstance;
+    command.parameterId = parameterId;
+    command.value = value;
+    return Post(command);
+}
+
+bool AudioThread::PostSetGlobalParameter(const std::string& name, float value)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetGlobalParameter;
+    command.value = value;
+    if (!command.SetName(name.c_str(), name.size()))
+    {
+        std::cerr << "FMOD: Parameter name too long to post: " << name << std::endl;
+        return false;
+    }
+    return Post(command);
+}
+
+bool AudioThread::PostSetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetGlobalParameterById;
+    command.parameterId = parameterId;
+    command.value = value;
+    return Post(command);
+}
+
+bool AudioThread::PostSetEventPosition(FMOD::Studio::EventInstance* eventInstance, float x, float y)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetEventPosition;
+    command.instance = eventInstance;
+    command.x = x;
+    command.y = y;
+    return Post(command);
+}
+
+bool AudioThread::PostSetListenerPosition(int listener, float x, float y)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetListenerPosition;
+    command.listener = listener;
+    command.x = x;
+    command.y = y;
+    return Post(command);
+}
+
+bool AudioThread::PostStartEvent(FMOD::Studio::EventInstance* eventInstance)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::StartEvent;
+    command.instance = eventInstance;
+    return Post(command);
+}
+
+bool AudioThread::PostStopEvent(FMOD::Studio::EventInstance* eventInstance, bool allowFadeOut)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::StopEvent;
+    command.instance = eventInstance;
+    command.flag = allowFadeOut;
+    return Post(command);
+}
+
+bool AudioThread::PostSetEventPaused(FMOD::Studio::EventInstance* eventInstance, bool paused)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetEventPaused;
+    command.instance = eventInstance;
+    command.flag = paused;
+    return Post(command);
+}
+
+bool AudioThread::PostSetEventVolume(FMOD::Studio::EventInstance* eventInstance, float volume)
+{
+    AudioCommand command;
+    command.type = AudioCommandType::SetEventVolume;
+    command.instance = eventInstance;
+    command.value = volume;
+    return Post(command);
+}
+
+AudioThreadStats AudioThread::GetStats() const
+{
+    AudioThreadStats stats;
+    stats.posted = m_Posted.load(std::memory_order_relaxed);
+    stats.dropped = m_Dropped.load(std::memory_order_relaxed);
+    stats.executed = m_Executed.load(std::memory_order_relaxed);
+    stats.queueDepth = m_Queue.GetApproximateSize();
+    stats.averageLatencyMs = (stats.executed > 0)
+        ? static_cast<float>(m_TotalLatencyMs.load(std::memory_order_relaxed) / static_cast<double>(stats.executed))
+        : 0.0f;
+    stats.maxLatencyMs = m_MaxLatencyMs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool AudioThread::Post(AudioCommand& command)
+{
+    command.postTime = std::chrono::steady_clock::now();
+    if (!m_Queue.Push(command))
+    {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_Posted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void AudioThread::Run()
+{
+    FMODAudioSystem& audioSystem = FMODAudioSystem::GetInstance();
+    auto lastTime = std::chrono::steady_clock::now();
+
+    while (m_Running.load(std::memory_order_acquire))
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_FmodMutex);
+
+            AudioCommand command;
+            while (m_Queue.Pop(command))
+            {
+                Execute(command);
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            std::chrono::duration<double> elapsed = now - lastTime;
+            lastTime = now;
+
+            int ticks = m_Scheduler->Advance(elapsed.count());
+            for (int i = 0; i < ticks; ++i)
+            {
+                auto tickStart = std::chrono::steady_clock::now();
+                audioSystem.Update();
+                m_Scheduler->RecordTick(tickStart, audioSystem.GetLastStudioUpdateMs(), i > 0);
+            }
+        }
+
+        // Short naps keep post-to-execute latency around a millisecond
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Flush whatever was posted before Stop
+    std::lock_guard<std::mutex> lock(m_FmodMutex);
+    AudioCommand command;
+    while (m_Queue.Pop(command))
+    {
+        Execute(command);
+    }
+}
+
+void AudioThread::Execute(const AudioCommand& command)
+{
+    FMODAudioSystem& audio = FMODAudioSystem::GetInstance();
+
+    switch (command.type)
+    {
+    case AudioCommandType::PlayOneShot:
+        audio.PlayOneShot(AudioEventId(std::string_view(command.name)), FMOD_VECTOR{ command.x, command.y, 0.0f });
+        break;
+    case AudioCommandType::SetEventParameter:
+        audio.SetEventParameter(command.instance, command.name, command.value);
+        break;
+    case AudioCommandType::SetEventParameterById:
+        audio.SetEventParameterById(command.instance, command.parameterId, command.value);
+        break;
+    case AudioCommandType::SetGlobalParameter:
+        audio.SetGlobalParameter(command.name, command.value);
+        break;
+    case AudioCommandType::SetGlobalParameterById:
+        audio.SetGlobalParameterById(command.parameterId, command.value);
+        break;
+    case AudioCommandType::SetEventPosition:
+        audio.Set3DEventPosition(command.instance, command.x, command.y);
+        break;
+    case AudioCommandType::SetListenerPosition:
+        audio.Set3DListenerPosition(command.listener, command.x, command.y);
+        break;
+    case AudioCommandType::StartEvent:
+        command.instance->start();
+        break;
+    case AudioCommandType::StopEvent:
+        command.instance->stop(command.flag ? FMOD_STUDIO_STOP_ALLOWFADEOUT : FMOD_STUDIO_STOP_IMMEDIATE);
+        break;
+    case AudioCommandType::SetEventPaused:
+        command.instance->setPaused(command.flag);
+        break;
+    case AudioCommandType::SetEventVolume:
+        command.instance->setVolume(command.value);
+        break;
+    }
+
+    std::chrono::duration<double, std::milli> latency = std::chrono::steady_clock::now() - command.postTime;
+    m_Executed.fetch_add(1, std::memory_order_relaxed);
+    m_TotalLatencyMs.store(m_TotalLatencyMs.load(std::memory_order_relaxed) + latency.count(), std::memory_order_relaxed);
+    if (latency.count() > m_MaxLatencyMs.load(std::memory_order_relaxed))
+    {
+        m_MaxLatencyMs.store(static_cast<float>(latency.count()), std::memory_order_relaxed);
+    }
+}
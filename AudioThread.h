@@ -0,0 +1,76 @@
+// AudioThread.h - Dedicated thread that owns all FMOD calls
+#pragma once
+
+#include "AudioCommandQueue.h"
+#include "AudioEventId.h"
+#include "AudioTickScheduler.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct AudioThreadStats
+{
+    uint64_t posted = 0;
+    uint64_t dropped = 0;              // Posts rejected because the ring was full
+    uint64_t executed = 0;
+    size_t queueDepth = 0;
+    float averageLatencyMs = 0.0f;     // Post to execution
+    float maxLatencyMs = 0.0f;
+};
+
+// Drains an AudioCommandQueue and ticks FMODAudioSystem::Update on its own thread,
+// paced by the given AudioTickScheduler (which it only touches while holding the
+// FMOD lock). Any thread may post commands without locking. Calls that need an immediate
+// answer (creating events, loading banks, ...) must hold LockFmod() instead,
+// which the thread also holds while it executes a batch.
+class AudioThread
+{
+public:
+    AudioThread() = default;
+    ~AudioThread();
+
+    AudioThread(const AudioThread&) = delete;
+    AudioThread& operator=(const AudioThread&) = delete;
+
+    bool Start(AudioTickScheduler* scheduler);
+    void Stop();
+    bool IsRunning() const { return m_Running.load(std::memory_order_acquire); }
+
+    // Thread-safe command posting; returns false if the queue is full
+    bool PostPlayOneShot(AudioEventId eventId, float x, float y);
+    bool PostSetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& name, float value);
+    bool PostSetEventParameterById(FMOD::Studio::EventInstance* eventInstance, FMOD_STUDIO_PARAMETER_ID parameterId, float value);
+    bool PostSetGlobalParameter(const std::string& name, float value);
+    bool PostSetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value);
+    bool PostSetEventPosition(FMOD::Studio::EventInstance* eventInstance, float x, float y);
+    bool PostSetListenerPosition(int listener, float x, float y);
+    bool PostStartEvent(FMOD::Studio::EventInstance* eventInstance);
+    bool PostStopEvent(FMOD::Studio::EventInstance* eventInstance, bool allowFadeOut);
+    bool PostSetEventPaused(FMOD::Studio::EventInstance* eventInstance, bool paused);
+    bool PostSetEventVolume(FMOD::Studio::EventInstance* eventInstance, float volume);
+
+    // Serializes synchronous wrapper calls with the audio thread
+    std::unique_lock<std::mutex> LockFmod() { return std::unique_lock<std::mutex>(m_FmodMutex); }
+
+    AudioThreadStats GetStats() const;
+
+private:
+    bool Post(AudioCommand& command);
+    void Run();
+    void Execute(const AudioCommand& command);
+
+    AudioCommandQueue m_Queue;
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{ false };
+    std::mutex m_FmodMutex;
+    AudioTickScheduler* m_Scheduler = nullptr;
+
+    std::atomic<uint64_t> m_Posted{ 0 };
+    std::atomic<uint64_t> m_Dropped{ 0 };
+
+    // Written by the audio thread only
+    std::atomic<uint64_t> m_Executed{ 0 };
+    std::atomic<double> m_TotalLatencyMs{ 0.0 };
+    std::atomic<float> m_MaxLatencyMs{ 0.0f };
+};
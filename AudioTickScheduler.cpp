@@ -0,0 +1,137 @@
+// AudioTickScheduler.cpp
+#include "AudioTickScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+    constexpr float kFirstBucketUpperMs = 0.01f;
+}
+
+void TimingHistogram::Record(float ms)
+{
+    int bucket = 0;
+    if (ms >= kFirstBucketUpperMs)
+    {
+        // Two buckets per doubling
+        bucket = 1 + static_cast<int>(2.0f * std::log2(ms / kFirstBucketUpperMs));
+        bucket = std::min(bucket, kBucketCount - 1);
+    }
+
+    ++m_Buckets[bucket];
+    m_Min = (m_Count == 0) ? ms : std::min(m_Min, ms);
+    m_Max = std::max(m_Max, ms);
+    m_Total += ms;
+    ++m_Count;
+}
+
+void TimingHistogram::Reset()
+{
+    *this = TimingHistogram();
+}
+
+float TimingHistogram::GetBucketUpperMs(int bucket)
+{
+    return kFirstBucketUpperMs * std::exp2(0.5f * static_cast<float>(bucket));
+}
+
+float TimingHistogram::GetPercentile(float fraction) const
+{
+    if (m_Count == 0)
+    {
+        return 0.0f;
+    }
+
+    uint64_t target = static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0f, 1.0f) * static_cast<double>(m_Count)));
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < kBucketCount; ++bucket)
+    {
+        seen += m_Buckets[bucket];
+        if (seen >= target && seen > 0)
+        {
+            // The overflow bucket has no upper edge; the max is the best bound
+            return (bucket == kBucketCount - 1) ? m_Max : std::min(GetBucketUpperMs(bucket), m_Max);
+        }
+    }
+
+    return m_Max;
+}
+
+void AudioTickScheduler::SetTickRate(float ticksPerSecond)
+{
+    if (ticksPerSecond <= 0.0f)
+    {
+        std::cerr << "FMOD: Audio tick rate must be positive" << std::endl;
+        return;
+    }
+
+    m_TickRate = ticksPerSecond;
+    m_TickInterval = 1.0 / static_cast<double>(ticksPerSecond);
+}
+
+int AudioTickScheduler::Advance(double elapsedSeconds)
+{
+    m_Accumulator += std::max(elapsedSeconds, 0.0);
+
+    int ticks = static_cast<int>(m_Accumulator / m_TickInterval);
+    if (ticks > m_MaxCatchUpTicks)
+    {
+        // Forget the backlog beyond the limit but keep the fractional remainder
+        m_DroppedTicks += static_cast<uint64_t>(ticks - m_MaxCatchUpTicks);
+        m_Accumulator -= static_cast<double>(ticks - m_MaxCatchUpTicks) * m_TickInterval;
+        ticks = m_MaxCatchUpTicks;
+    }
+
+    if (ticks > 1)
+    {
+        m_CatchUpTicks += static_cast<uint64_t>(ticks - 1);
+    }
+
+    m_Accumulator -= static_cast<double>(ticks) * m_TickInterval;
+    return ticks;
+}
+
+void AudioTickScheduler::RecordTick(std::chrono::steady_clock::time_point tickStart, float updateMs, bool catchUp)
+{
+    m_UpdateMs.Record(updateMs);
+    ++m_Ticks;
+
+    // Catch-up ticks are counted by Advance; timing them would only add near-zero
+    // gaps and hide the late scheduled tick that caused them
+    if (catchUp)
+    {
+        return;
+    }
+
+    if (m_HasTicked)
+    {
+        std::chrono::duration<double, std::milli> interval = tickStart - m_LastScheduledStart;
+        m_JitterMs.Record(static_cast<float>(std::fabs(interval.count() - m_TickInterval * 1000.0)));
+    }
+
+    m_LastScheduledStart = tickStart;
+    m_HasTicked = true;
+}
+
+AudioTickStats AudioTickScheduler::GetStats() const
+{
+    AudioTickStats stats;
+    stats.tickRateHz = m_TickRate;
+    stats.ticks = m_Ticks;
+    stats.catchUpTicks = m_CatchUpTicks;
+    stats.droppedTicks = m_DroppedTicks;
+    stats.updateMs = m_UpdateMs;
+    stats.jitterMs = m_JitterMs;
+    return stats;
+}
+
+void AudioTickScheduler::ResetStats()
+{
+    m_Ticks = 0;
+    m_CatchUpTicks = 0;
+    m_DroppedTicks = 0;
+    m_UpdateMs.Reset();
+    m_JitterMs.Reset();
+    m_HasTicked = false;
+}
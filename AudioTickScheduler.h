@@ -0,0 +1,86 @@
+// AudioTickScheduler.h - Fixed-step audio tick scheduling with timing histograms
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Log-spaced histogram of millisecond timings. Bucket 0 holds samples under 10 us;
+// each following bucket is sqrt(2) wider than the last, up to about half a second,
+// and the last bucket also takes everything beyond. Percentiles resolve to the
+// upper edge of their bucket; min, max and mean are exact.
+class TimingHistogram
+{
+public:
+    static constexpr int kBucketCount = 32;
+
+    void Record(float ms);
+    void Reset();
+
+    // Upper edge of the bucket holding the given fraction (0..1) of samples
+    float GetPercentile(float fraction) const;
+    static float GetBucketUpperMs(int bucket);
+
+    uint64_t GetCount() const { return m_Count; }
+    uint64_t GetBucket(int bucket) const { return m_Buckets[bucket]; }
+    float GetMin() const { return m_Count > 0 ? m_Min : 0.0f; }
+    float GetMax() const { return m_Max; }
+    float GetMean() const { return m_Count > 0 ? static_cast<float>(m_Total / m_Count) : 0.0f; }
+
+private:
+    uint64_t m_Buckets[kBucketCount] = {};
+    uint64_t m_Count = 0;
+    double m_Total = 0.0;
+    float m_Min = 0.0f;
+    float m_Max = 0.0f;
+};
+
+struct AudioTickStats
+{
+    float tickRateHz = 0.0f;
+    uint64_t ticks = 0;
+    uint64_t catchUpTicks = 0;  // Extra ticks run in the same frame to catch up
+    uint64_t droppedTicks = 0;  // Ticks skipped because catch-up was over the limit
+    TimingHistogram updateMs;   // Time spent in the Studio update per tick
+    TimingHistogram jitterMs;   // |time between scheduled tick starts - tick interval|
+};
+
+// Turns variable frame times into a whole number of fixed-length audio ticks.
+// Time not yet worth a tick carries over to the next Advance instead of being
+// dropped. After a long stall at most the catch-up limit of ticks is run and the
+// rest of the backlog is discarded (and counted), so a hitch doesn't turn into a
+// burst of back-to-back updates.
+class AudioTickScheduler
+{
+public:
+    void SetTickRate(float ticksPerSecond);
+    float GetTickRate() const { return m_TickRate; }
+    double GetTickInterval() const { return m_TickInterval; }
+    void SetMaxCatchUpTicks(int maxTicks) { m_MaxCatchUpTicks = maxTicks > 0 ? maxTicks : 1; }
+
+    // Adds elapsed time and returns how many ticks are due now
+    int Advance(double elapsedSeconds);
+
+    // Records one tick that started at tickStart and spent updateMs in the Studio update.
+    // catchUp marks the extra ticks after the first of an Advance; they run back to
+    // back by design, so they are kept out of the jitter histogram.
+    void RecordTick(std::chrono::steady_clock::time_point tickStart, float updateMs, bool catchUp);
+
+    AudioTickStats GetStats() const;
+    void ResetStats();
+
+private:
+    float m_TickRate = 60.0f;
+    double m_TickInterval = 1.0 / 60.0;
+    int m_MaxCatchUpTicks = 4;
+    double m_Accumulator = 0.0;
+
+    std::chrono::steady_clock::time_point m_LastScheduledStart;
+    bool m_HasTicked = false;
+
+    uint64_t m_Ticks = 0;
+    uint64_t m_CatchUpTicks = 0;
+    uint64_t m_DroppedTicks = 0;
+    TimingHistogram m_UpdateMs;
+    TimingHistogram m_JitterMs;
+};
@@ -0,0 +1,263 @@
+// EmitterStore.cpp
+#include "EmitterStore.h"
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define EMITTER_STORE_SSE 1
+#endif
+
+namespace
+{
+    uint32_t IdSlot(EmitterId id) { return static_cast<uint32_t>(id); }
+}
+
+EmitterId EmitterStore::Add(FMOD::Studio::EventInstance* instance, float x, float y)
+{
+    uint32_t slot;
+    if (!m_FreeIds.empty())
+    {
+        slot = m_FreeIds.back();
+        m_FreeIds.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_IdToIndex.size());
+        m_IdToIndex.push_back(0);
+        m_IdGenerations.push_back(1);
+    }
+
+    EmitterId id = (static_cast<EmitterId>(m_IdGenerations[slot]) << 32) | slot;
+    m_IdToIndex[slot] = static_cast<uint32_t>(m_Instances.size());
+
+    // An infinite last-sent position makes the first Flush always send
+    m_X.push_back(x);
+    m_Y.push_back(y);
+    m_VX.push_back(0.0f);
+    m_VY.push_back(0.0f);
+    m_SentX.push_back(std::numeric_limits<float>::infinity());
+    m_SentY.push_back(std::numeric_limits<float>::infinity());
+    m_Distance.push_back(0.0f);
+    m_Changed.push_back(1);
+    m_Instances.push_back(instance);
+    m_Ids.push_back(id);
+    return id;
+}
+
+bool EmitterStore::FindIndex(EmitterId id, uint32_t& index) const
+{
+    // A freed ID's slot may point at an index now owned by another emitter, or have
+    // been reused under a newer generation; either way the stored ID won't match
+    uint32_t slot = IdSlot(id);
+    if (slot >= m_IdToIndex.size())
+    {
+        return false;
+    }
+
+    index = m_IdToIndex[slot];
+    return index < m_Ids.size() && m_Ids[index] == id;
+}
+
+void EmitterStore::FreeIdSlot(EmitterId id)
+{
+    // Skip 0 on wrap-around so a live ID is never kInvalidEmitterId
+    uint32_t slot = IdSlot(id);
+    if (++m_IdGenerations[slot] == 0)
+    {
+        m_IdGenerations[slot] = 1;
+    }
+
+    m_FreeIds.push_back(slot);
+}
+
+void EmitterStore::Remove(EmitterId id)
+{
+    uint32_t index = 0;
+    if (!FindIndex(id, index))
+    {
+        return;
+    }
+
+    // Swap the last emitter into the hole
+    uint32_t last = static_cast<uint32_t>(m_Instances.size() - 1);
+    if (index != last)
+    {
+        m_X[index] = m_X[last];
+        m_Y[index] = m_Y[last];
+        m_VX[index] = m_VX[last];
+        m_VY[index] = m_VY[last];
+        m_SentX[index] = m_SentX[last];
+        m_SentY[index] = m_SentY[last];
+        m_Distance[index] = m_Distance[last];
+        m_Changed[index] = m_Changed[last];
+        m_Instances[index] = m_Instances[last];
+        m_Ids[index] = m_Ids[last];
+        m_IdToIndex[IdSlot(m_Ids[index])] = index;
+    }
+
+    m_X.pop_back();
+    m_Y.pop_back();
+    m_VX.pop_back();
+    m_VY.pop_back();
+    m_SentX.pop_back();
+    m_SentY.pop_back();
+    m_Distance.pop_back();
+    m_Changed.pop_back();
+    m_Instances.pop_back();
+    m_Ids.pop_back();
+    FreeIdSlot(id);
+}
+
+void EmitterStore::Clear()
+{
+    // Generations survive so IDs handed out before the Clear stay stale
+    for (EmitterId id : m_Ids)
+    {
+        FreeIdSlot(id);
+    }
+
+    m_X.clear();
+    m_Y.clear();
+    m_VX.clear();
+    m_VY.clear();
+    m_SentX.clear();
+    m_SentY.clear();
+    m_Distance.clear();
+    m_Changed.clear();
+    m_Instances.clear();
+    m_Ids.clear();
+}
+
+void EmitterStore::UpdateEmitters(std::span<const EmitterUpdate> updates)
+{
+    for (const EmitterUpdate& update : updates)
+    {
+        uint32_t index = 0;
+        if (!FindIndex(update.id, index))
+        {
+            continue;
+        }
+
+        m_X[index] = update.x;
+        m_Y[index] = update.y;
+        m_VX[index] = update.vx;
+        m_VY[index] = update.vy;
+    }
+}
+
+void EmitterStore::ComputeDistancesAndChanges(const AudioListenerSet& listeners)
+{
+    size_t count = m_Instances.size();
+    size_t i = 0;
+
+#ifdef EMITTER_STORE_SSE
+    const __m128 epsilon = _mm_set1_ps(m_Epsilon);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+    // Listeners are splatted once; the inner loop is a min over at most FMOD_MAX_LISTENERS
+    __m128 lx[FMOD_MAX_LISTENERS];
+    __m128 ly[FMOD_MAX_LISTENERS];
+    for (int l = 0; l < listeners.count; ++l)
+    {
+        lx[l] = _mm_set1_ps(listeners.x[l]);
+        ly[l] = _mm_set1_ps(listeners.y[l]);
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&m_X[i]);
+        __m128 y = _mm_loadu_ps(&m_Y[i]);
+
+        __m128 dx = _mm_sub_ps(x, lx[0]);
+        __m128 dy = _mm_sub_ps(y, ly[0]);
+        __m128 nearest = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        for (int l = 1; l < listeners.count; ++l)
+        {
+            dx = _mm_sub_ps(x, lx[l]);
+            dy = _mm_sub_ps(y, ly[l]);
+            nearest = _mm_min_ps(nearest, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        }
+        _mm_storeu_ps(&m_Distance[i], _mm_sqrt_ps(nearest));
+
+        __m128 movedX = _mm_and_ps(_mm_sub_ps(x, _mm_loadu_ps(&m_SentX[i])), absMask);
+        __m128 movedY = _mm_and_ps(_mm_sub_ps(y, _mm_loadu_ps(&m_SentY[i])), absMask);
+        __m128 changed = _mm_or_ps(_mm_cmpgt_ps(movedX, epsilon), _mm_cmpgt_ps(movedY, epsilon));
+
+        int mask = _mm_movemask_ps(changed);
+        m_Changed[i + 0] = static_cast<uint8_t>(mask & 1);
+        m_Changed[i + 1] = static_cast<uint8_t>((mask >> 1) & 1);
+        m_Changed[i + 2] = static_cast<uint8_t>((mask >> 2) & 1);
+        m_Changed[i + 3] = static_cast<uint8_t>((mask >> 3) & 1);
+    }
+#endif
+
+    // Remainder (or everything, without SSE)
+    for (; i < count; ++i)
+    {
+        m_Distance[i] = std::sqrt(listeners.NearestDistanceSquared(m_X[i], m_Y[i]));
+        m_Changed[i] = (std::fabs(m_X[i] - m_SentX[i]) > m_Epsilon || std::fabs(m_Y[i] - m_SentY[i]) > m_Epsilon) ? 1 : 0;
+    }
+}
+
+void EmitterStore::Flush(const AudioListenerSet& listeners)
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    ComputeDistancesAndChanges(listeners);
+
+    std::vector<EmitterId> released;
+    size_t count = m_Instances.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!m_Changed[i])
+        {
+            ++m_AttributesSkipped;
+            continue;
+        }
+
+        FMOD_3D_ATTRIBUTES attributes = {};
+        attributes.position = { m_X[i], m_Y[i], 0.0f };
+        attributes.velocity = { m_VX[i], m_VY[i], 0.0f };
+        attributes.forward = { 0.0f, 0.0f, 1.0f };
+        attributes.up = { 0.0f, 1.0f, 0.0f };
+
+        FMOD_RESULT result = m_Instances[i]->set3DAttributes(&attributes);
+        if (result == FMOD_ERR_INVALID_HANDLE)
+        {
+            released.push_back(m_Ids[i]);
+            continue;
+        }
+
+        m_SentX[i] = m_X[i];
+        m_SentY[i] = m_Y[i];
+        ++m_AttributesSent;
+    }
+
+    for (EmitterId id : released)
+    {
+        Remove(id);
+    }
+
+    ++m_Flushes;
+    std::chrono::duration<float, std::milli> flushTime = std::chrono::steady_clock::now() - startTime;
+    m_LastFlushMs = flushTime.count();
+}
+
+float EmitterStore::GetDistance(EmitterId id) const
+{
+    uint32_t index = 0;
+    return FindIndex(id, index) ? m_Distance[index] : -1.0f;
+}
+
+EmitterStoreStats EmitterStore::GetStats() const
+{
+    EmitterStoreStats stats;
+    stats.emitters = m_Instances.size();
+    stats.flushes = m_Flushes;
+    stats.attributesSent = m_AttributesSent;
+    stats.attributesSkipped = m_AttributesSkipped;
+    stats.lastFlushMs = m_LastFlushMs;
+    return stats;
+}
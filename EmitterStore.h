@@ -0,0 +1,89 @@
+// EmitterStore.h - Structure-of-arrays emitter positions with batched 3D updates
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "AudioListenerSet.h"
+
+// Slot in the low 32 bits, slot generation in the high 32. Generations start at 1 and
+// are bumped whenever the emitter is removed, so an ID held past its emitter's removal
+// never matches the emitter that reuses the slot.
+using EmitterId = uint64_t;
+constexpr EmitterId kInvalidEmitterId = 0;
+
+// One emitter's new position (and velocity, for doppler) for UpdateEmitters
+struct EmitterUpdate
+{
+    EmitterId id = kInvalidEmitterId;
+    float x = 0.0f;
+    float y = 0.0f;
+    float vx = 0.0f;
+    float vy = 0.0f;
+};
+
+struct EmitterStoreStats
+{
+    size_t emitters = 0;
+    uint64_t flushes = 0;
+    uint64_t attributesSent = 0;    // set3DAttributes calls made
+    uint64_t attributesSkipped = 0; // Emitters that hadn't moved past the epsilon
+    float lastFlushMs = 0.0f;
+};
+
+// Positions of event instances kept as parallel arrays. UpdateEmitters only writes
+// the arrays; Flush computes every emitter's distance to its nearest listener in one
+// SIMD pass and calls set3DAttributes only for emitters that moved further than the
+// epsilon since the attributes were last sent. Emitters whose instance has been
+// released are dropped during Flush; later calls with their IDs are ignored.
+class EmitterStore
+{
+public:
+    EmitterId Add(FMOD::Studio::EventInstance* instance, float x, float y);
+    void Remove(EmitterId id);
+    void Clear();
+
+    void UpdateEmitters(std::span<const EmitterUpdate> updates);
+
+    void SetEpsilon(float epsilon) { m_Epsilon = epsilon; }
+
+    // Sends changed positions to FMOD; call once per frame before the Studio update
+    void Flush(const AudioListenerSet& listeners);
+
+    // Nearest listener distance as of the last Flush; negative for an unknown emitter
+    float GetDistance(EmitterId id) const;
+
+    size_t GetCount() const { return m_Instances.size(); }
+    EmitterStoreStats GetStats() const;
+
+private:
+    bool FindIndex(EmitterId id, uint32_t& index) const;
+    void FreeIdSlot(EmitterId id);
+    void ComputeDistancesAndChanges(const AudioListenerSet& listeners);
+
+    float m_Epsilon = 0.01f;
+
+    // Dense arrays, one element per emitter
+    std::vector<float> m_X;
+    std::vector<float> m_Y;
+    std::vector<float> m_VX;
+    std::vector<float> m_VY;
+    std::vector<float> m_SentX;
+    std::vector<float> m_SentY;
+    std::vector<float> m_Distance;
+    std::vector<uint8_t> m_Changed;
+    std::vector<FMOD::Studio::EventInstance*> m_Instances;
+    std::vector<EmitterId> m_Ids;
+
+    // ID slots map to dense indices; removal swaps the last emitter into the hole
+    std::vector<uint32_t> m_IdToIndex;
+    std::vector<uint32_t> m_IdGenerations;
+    std::vector<uint32_t> m_FreeIds;
+
+    uint64_t m_Flushes = 0;
+    uint64_t m_AttributesSent = 0;
+    uint64_t m_AttributesSkipped = 0;
+    float m_LastFlushMs = 0.0f;
+};
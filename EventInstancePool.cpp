@@ -0,0 +1,236 @@
+// EventInstancePool.cpp
+#include "EventInstancePool.h"
+#include <fmod_errors.h>
+#include <iostream>
+
+void EventInstancePool::Prewarm(FMOD::Studio::Bank* bank)
+{
+    if (m_PoolSize <= 0)
+    {
+        return;
+    }
+
+    int count = 0;
+    if (bank->getEventCount(&count) != FMOD_OK || count <= 0)
+    {
+        return;
+    }
+
+    std::vector<FMOD::Studio::EventDescription*> descriptions(count);
+    if (bank->getEventList(descriptions.data(), count, &count) != FMOD_OK)
+    {
+        return;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        // Looping and snapshot events are never fire-and-forget
+        bool oneshot = false;
+        if (descriptions[i]->isOneshot(&oneshot) != FMOD_OK || !oneshot)
+        {
+            continue;
+        }
+
+        Pool& pool = m_Pools[descriptions[i]];
+        while (static_cast<int>(pool.idle.size()) < m_PoolSize)
+        {
+            FMOD::Studio::EventInstance* instance = CreatePooledInstance(descriptions[i]);
+            if (instance == nullptr)
+            {
+                break;
+            }
+
+            pool.idle.push_back(instance);
+        }
+    }
+}
+
+FMOD::Studio::EventInstance* EventInstancePool::CreatePooledInstance(FMOD::Studio::EventDescription* description)
+{
+    FMOD::Studio::EventInstance* instance = nullptr;
+    FMOD_RESULT result = description->createInstance(&instance);
+    if (result != FMOD_OK || instance == nullptr)
+    {
+        std::cerr << "FMOD: Failed to create pooled event instance: " << FMOD_ErrorString(result) << std::endl;
+        return nullptr;
+    }
+
+    instance->setUserData(this);
+    instance->setCallback(OnEventStopped, FMOD_STUDIO_EVENT_CALLBACK_STOPPED);
+    return instance;
+}
+
+FMOD::Studio::EventInstance* EventInstancePool::Acquire(FMOD::Studio::EventDescription* description)
+{
+    Pool& pool = m_Pools[description];
+    if (!pool.idle.empty())
+    {
+        FMOD::Studio::EventInstance* instance = pool.idle.back();
+        pool.idle.pop_back();
+        ResetInstance(description, pool, instance);
+        ++pool.active;
+        ++m_Reuses;
+        return instance;
+    }
+
+    FMOD::Studio::EventInstance* instance = CreatePooledInstance(description);
+    if (instance != nullptr)
+    {
+        ++pool.active;
+        ++m_FallbackCreates;
+    }
+
+    return instance;
+}
+
+void EventInstancePool::ResetInstance(FMOD::Studio::EventDescription* description, Pool& pool, FMOD::Studio::EventInstance* instance)
+{
+    if (!pool.parametersCached)
+    {
+        pool.parametersCached = true;
+
+        int count = 0;
+        description->getParameterDescriptionCount(&count);
+        for (int i = 0; i < count; ++i)
+        {
+            FMOD_STUDIO_PARAMETER_DESCRIPTION parameter = {};
+            if (description->getParameterDescriptionByIndex(i, &parameter) != FMOD_OK)
+            {
+                continue;
+            }
+
+            // Read-only, automatic and global parameters aren't per-instance game state
+            const FMOD_STUDIO_PARAMETER_FLAGS skip = FMOD_STUDIO_PARAMETER_READONLY | FMOD_STUDIO_PARAMETER_AUTOMATIC | FMOD_STUDIO_PARAMETER_GLOBAL;
+            if ((parameter.flags & skip) == 0)
+            {
+                pool.parameters.push_back(parameter);
+            }
+        }
+    }
+
+    // Whatever the previous user set would otherwise carry over into this play
+    instance->setVolume(1.0f);
+    instance->setPitch(1.0f);
+    instance->setPaused(false);
+    for (const FMOD_STUDIO_PARAMETER_DESCRIPTION& parameter : pool.parameters)
+    {
+        instance->setParameterByID(parameter.id, parameter.defaultvalue, true);
+    }
+}
+
+bool EventInstancePool::ReleaseIdle(FMOD::Studio::EventDescription* description)
+{
+    auto it = m_Pools.find(description);
+    if (it == m_Pools.end() || it->second.idle.empty())
+    {
+        return false;
+    }
+
+    for (FMOD::Studio::EventInstance* instance : it->second.idle)
+    {
+        instance->release();
+    }
+    it->second.idle.clear();
+    return true;
+}
+
+void EventInstancePool::Recycle(FMOD::Studio::EventInstance* instance)
+{
+    std::lock_guard<std::mutex> lock(m_StoppedMutex);
+    m_Stopped.push_back(instance);
+}
+
+FMOD_RESULT F_CALL EventInstancePool::OnEventStopped(FMOD_STUDIO_EVENT_CALLBACK_TYPE, FMOD_STUDIO_EVENTINSTANCE* event, void*)
+{
+    FMOD::Studio::EventInstance* instance = reinterpret_cast<FMOD::Studio::EventInstance*>(event);
+
+    void* userData = nullptr;
+    if (instance->getUserData(&userData) == FMOD_OK && userData != nullptr)
+    {
+        static_cast<EventInstancePool*>(userData)->Recycle(instance);
+    }
+
+    return FMOD_OK;
+}
+
+void EventInstancePool::Update()
+{
+    std::vector<FMOD::Studio::EventInstance*> stopped;
+    {
+        std::lock_guard<std::mutex> lock(m_StoppedMutex);
+        if (m_Stopped.empty())
+        {
+            return;
+        }
+        stopped.swap(m_Stopped);
+    }
+
+    for (FMOD::Studio::EventInstance* instance : stopped)
+    {
+        // Instances of unloaded banks are already gone along with their pool
+        FMOD::Studio::EventDescription* description = nullptr;
+        if (instance->getDescription(&description) != FMOD_OK)
+        {
+            continue;
+        }
+
+        auto it = m_Pools.find(description);
+        if (it == m_Pools.end())
+        {
+            instance->release();
+            continue;
+        }
+
+        Pool& pool = it->second;
+        --pool.active;
+        if (static_cast<int>(pool.idle.size()) < m_PoolSize)
+        {
+            pool.idle.push_back(instance);
+        }
+        else
+        {
+            instance->release();
+            ++m_OverflowReleases;
+        }
+    }
+}
+
+void EventInstancePool::RemoveInvalid()
+{
+    for (auto it = m_Pools.begin(); it != m_Pools.end();)
+    {
+        if (!it->first->isValid())
+        {
+            it = m_Pools.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void EventInstancePool::Reset()
+{
+    m_Pools.clear();
+
+    std::lock_guard<std::mutex> lock(m_StoppedMutex);
+    m_Stopped.clear();
+}
+
+EventInstancePoolStats EventInstancePool::GetStats() const
+{
+    EventInstancePoolStats stats;
+    stats.pools = static_cast<int>(m_Pools.size());
+    stats.reuses = m_Reuses;
+    stats.fallbackCreates = m_FallbackCreates;
+    stats.overflowReleases = m_OverflowReleases;
+
+    for (const auto& pool : m_Pools)
+    {
+        stats.idleInstances += static_cast<int>(pool.second.idle.size());
+        stats.activeInstances += pool.second.active;
+    }
+
+    return stats;
+}
@@ -0,0 +1,82 @@
+// EventInstancePool.h - Recycled event instances for fire-and-forget one-shots
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct EventInstancePoolStats
+{
+    int pools = 0;
+    int idleInstances = 0;         // Stopped and ready to reuse
+    int activeInstances = 0;       // Handed out and not yet recycled
+    uint64_t reuses = 0;           // Acquires served from a pool
+    uint64_t fallbackCreates = 0;  // Acquires that had to create an instance
+    uint64_t overflowReleases = 0; // Recycles released because the pool was full
+};
+
+// Per-EventDescription pools of event instances. Pools are pre-warmed with a fixed
+// number of instances when a bank loads; a pooled instance that stops is put back
+// instead of released, and creation only happens when a pool runs dry. Pools keep
+// at most their configured size of idle instances. A reused instance has its volume,
+// pitch, pause state and parameters put back to their defaults before it is handed out.
+class EventInstancePool
+{
+public:
+    void SetPoolSize(int instancesPerEvent) { m_PoolSize = instancesPerEvent; }
+    int GetPoolSize() const { return m_PoolSize; }
+
+    // Creates the pool instances for every one-shot event in the bank
+    void Prewarm(FMOD::Studio::Bank* bank);
+
+    // Returns an idle instance, or a new one if the pool is empty
+    FMOD::Studio::EventInstance* Acquire(FMOD::Studio::EventDescription* description);
+
+    // Releases the description's idle instances so they stop pinning its sample data.
+    // Returns false if it had none. Instances handed out are recycled as usual.
+    bool ReleaseIdle(FMOD::Studio::EventDescription* description);
+
+    // Returns an acquired instance that was never started (and so will never stop)
+    void Recycle(FMOD::Studio::EventInstance* instance);
+
+    // Moves instances stopped since the last call back to their pools; call once per frame
+    void Update();
+
+    // Drops pools whose descriptions were invalidated by a bank unload
+    void RemoveInvalid();
+
+    // Forgets every pool without releasing; call once the Studio system is released
+    void Reset();
+
+    EventInstancePoolStats GetStats() const;
+
+private:
+    struct Pool
+    {
+        std::vector<FMOD::Studio::EventInstance*> idle;
+        int active = 0;
+
+        // Game-settable parameters and their defaults, for resetting reused instances
+        std::vector<FMOD_STUDIO_PARAMETER_DESCRIPTION> parameters;
+        bool parametersCached = false;
+    };
+
+    FMOD::Studio::EventInstance* CreatePooledInstance(FMOD::Studio::EventDescription* description);
+    void ResetInstance(FMOD::Studio::EventDescription* description, Pool& pool, FMOD::Studio::EventInstance* instance);
+
+    // Runs on the Studio update thread
+    static FMOD_RESULT F_CALL OnEventStopped(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE* event, void* parameters);
+
+    int m_PoolSize = 0;
+    uint64_t m_Reuses = 0;
+    uint64_t m_FallbackCreates = 0;
+    uint64_t m_OverflowReleases = 0;
+
+    std::unordered_map<FMOD::Studio::EventDescription*, Pool> m_Pools;
+
+    // Filled by OnEventStopped and Recycle, drained by Update
+    std::mutex m_StoppedMutex;
+    std::vector<FMOD::Studio::EventInstance*> m_Stopped;
+};
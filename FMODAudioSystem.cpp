@@ -1,6 +1,38 @@
 // FMODAudioSystem.cpp
 #include "FMODAudioSystem.h"
 #include <iostream>
+#include <thread>
+#include <climits>
+
+namespace
+{
+    // Reads the path of a Studio handle (Bus, VCA, ...). Fails if the strings bank isn't loaded.
+    template <typename Handle>
+    bool GetHandlePath(Handle* handle, std::string& path)
+    {
+        char buffer[256];
+        int retrieved = 0;
+        FMOD_RESULT result = handle->getPath(buffer, sizeof(buffer), &retrieved);
+        if (result == FMOD_ERR_TRUNCATED)
+        {
+            std::vector<char> large(retrieved);
+            result = handle->getPath(large.data(), retrieved, &retrieved);
+            if (result == FMOD_OK)
+            {
+                path.assign(large.data());
+            }
+            return (result == FMOD_OK);
+        }
+
+        if (result != FMOD_OK)
+        {
+            return false;
+        }
+
+        path.assign(buffer);
+        return true;
+    }
+}
 
 FMODAudioSystem& FMODAudioSystem::GetInstance()
 {
@@ -16,6 +48,16 @@ bool FMODAudioSystem::Initialize(int maxChannels, int studioFlags, int coreFlags
         return false;
     }
 
+    // The allocator has to be in place before FMOD makes its first allocation
+    if (m_UseCustomAllocator && !AudioAllocator::IsInstalled())
+    {
+        if (ErrorCheck(AudioAllocator::Install(m_AllocatorArenaBytes)) != FMOD_OK)
+        {
+            std::cerr << "FMOD: Failed to install custom allocator!" << std::endl;
+            return false;
+        }
+    }
+
     // Create the Studio System
     FMOD_RESULT result = FMOD::Studio::System::create(&m_StudioSystem);
     if (ErrorCheck(result) != FMOD_OK)
@@ -32,6 +74,19 @@ bool FMODAudioSystem::Initialize(int maxChannels, int studioFlags, int coreFlags
         return false;
     }
 
+    // Route file reads through the prioritized I/O scheduler if requested
+    if (m_UseAsyncFileSystem)
+    {
+        m_FileSystem = std::make_unique<AsyncFileSystem>();
+        result = m_FileSystem->Install(m_CoreSystem, m_FileSystemThreads);
+        if (ErrorCheck(result) != FMOD_OK)
+        {
+            std::cerr << "FMOD: Failed to install async file system!" << std::endl;
+            m_FileSystem = nullptr;
+            return false;
+        }
+    }
+
     // Initialize the studio system
     result = m_CoreSystem->setSoftwareFormat(0, FMOD_SPEAKERMODE_STEREO, 0);
     if (ErrorCheck(result) != FMOD_OK)
@@ -40,7 +95,13 @@ bool FMODAudioSystem::Initialize(int maxChannels, int studioFlags, int coreFlags
         return false;
     }
 
-    result = m_CoreSystem->setDSPBufferSize(1024, 10);
+    DSPBufferProfile bufferProfile = { 1024, 10 };
+    if (m_AdaptiveLatency)
+    {
+        bufferProfile = m_LatencyProfiles.GetCurrentProfile();
+    }
+
+    result = m_CoreSystem->setDSPBufferSize(bufferProfile.bufferLength, bufferProfile.numBuffers);
     if (ErrorCheck(result) != FMOD_OK)
     {
         std::cerr << "FMOD: Failed to set DSP buffer size!" << std::endl;
@@ -69,10 +130,27 @@ bool FMODAudioSystem::Initialize(int maxChannels, int studioFlags, int coreFlags
         return false;
     }
 
+    // Bring back the listener setup from before a Restart
+    if (m_NumListeners > 1)
+    {
+        ErrorCheck(m_StudioSystem->setNumListeners(m_NumListeners));
+        for (int i = 0; i < m_NumListeners; ++i)
+        {
+            ErrorCheck(m_StudioSystem->setListenerWeight(i, m_Listeners[i].weight));
+        }
+    }
+
+    m_MaxChannels = maxChannels;
+    m_StudioFlags = studioFlags;
+    m_CoreFlags = coreFlags;
     m_Initialized = true;
 
-    
-    std::cout << "FMOD: Successfully initialized." << std::endl;
+    if (m_AdaptiveLatency)
+    {
+        m_LatencyProfiles.OnSystemStarted(m_CoreSystem);
+    }
+
+    std::cout << "FMOD: Successfully initialized with a " << bufferProfile.bufferLength << " x " << bufferProfile.numBuffers << " DSP buffer." << std::endl;
     return true;
 }
 
@@ -83,19 +161,25 @@ void FMODAudioSystem::Shutdown()
         return;
     }
 
+    // Abandon any banks still loading
+    for (auto& pending : m_PendingBankLoads)
+    {
+        pending.bank->unload();
+        pending.status->state = BankLoadState::Failed;
+    }
+    m_PendingBankLoads.clear();
+
     // Unload all banks
     for (auto& bank : m_Banks)
     {
         bank.second->unload();
     }
     m_Banks.clear();
+    m_BankSources.clear();
 
-    // Release all sounds
-    for (auto& sound : m_Sounds)
-    {
-        sound.second->release();
-    }
-    m_Sounds.clear();
+    // Release all sounds and reverbs
+    m_SoundCache.Clear();
+    m_ReverbZones.ReleaseReverbs();
 
     // Release snapshots
     for (auto& snapshot : m_ActiveSnapshots)
@@ -105,7 +189,15 @@ void FMODAudioSystem::Shutdown()
     m_ActiveSnapshots.clear();
 
     // Clear event descriptions
-    m_EventDescriptions.clear();
+    m_OneShotCoalescer.Clear();
+    m_Emitters.Clear();
+    m_EventDescriptions.Clear();
+    m_EventMetadata.Clear();
+    m_EventParameterIds.Clear();
+    m_GlobalParameterIds.Clear();
+    m_Buses.Clear();
+    m_VCAs.Clear();
+    m_SampleResidency.Clear();
 
     // Shutdown studio system
     if (m_StudioSystem)
@@ -114,11 +206,175 @@ void FMODAudioSystem::Shutdown()
         m_StudioSystem = nullptr;
     }
 
+    // Pooled instances went with the studio system
+    m_InstancePools.Reset();
+
+    // Only safe to unmap once the studio system has let go of the bank data
+    m_MappedBanks.clear();
+
+    // Persistent allocations are all freed by release, so the arena can be reused
+    if (AudioAllocator::IsInstalled())
+    {
+        AudioAllocator::ResetArenaIfUnused();
+    }
+
+    // No more reads can arrive once the systems are released
+    if (m_FileSystem)
+    {
+        m_FileSystem->Shutdown();
+        m_FileSystem = nullptr;
+    }
+
+    // A new system starts with its listeners at the origin
+    for (ListenerState& listener : m_Listeners)
+    {
+        listener.position = { 0.0f, 0.0f, 0.0f };
+    }
+    RebuildActiveListeners();
+
+    m_RestartPending = false;
     m_Initialized = false;
     std::cout << "FMOD: Successfully shutdown." << std::endl;
 }
 
-bool FMODAudioSystem::LoadBank(const std::string& bankName, const std::string& bankPath)
+bool FMODAudioSystem::Restart()
+{
+    if (!m_Initialized)
+    {
+        std::cerr << "FMOD: System not initialized!" << std::endl;
+        return false;
+    }
+
+    // Remember what to bring back; Shutdown clears all of it
+    std::map<std::string, BankSource> bankSources = m_BankSources;
+    for (const auto& pending : m_PendingBankLoads)
+    {
+        bankSources[pending.status->bankName] = pending.source;
+    }
+
+    std::vector<std::string> snapshots;
+    for (const auto& snapshot : m_ActiveSnapshots)
+    {
+        snapshots.push_back(snapshot.first);
+    }
+
+    Shutdown();
+    bool success = Initialize(m_MaxChannels, m_StudioFlags, m_CoreFlags);
+    if (success)
+    {
+        for (const auto& bank : bankSources)
+        {
+            success = LoadBank(bank.first, bank.second.path, bank.second.mode) && success;
+        }
+
+        for (const std::string& snapshot : snapshots)
+        {
+            success = StartSnapshot(snapshot) && success;
+        }
+    }
+
+    // Every instance is gone either way
+    if (m_RestartCallback)
+    {
+        m_RestartCallback();
+    }
+
+    return success;
+}
+
+bool FMODAudioSystem::ApplyPendingRestart()
+{
+    if (!m_RestartPending)
+    {
+        return false;
+    }
+
+    m_RestartPending = false;
+    Restart();
+    return true;
+}
+
+void FMODAudioSystem::SetAdaptiveLatencyEnabled(bool enabled, const std::string& persistPath)
+{
+    if (m_Initialized)
+    {
+        std::cerr << "FMOD: Adaptive latency can only be changed before initialization!" << std::endl;
+        return;
+    }
+
+    m_AdaptiveLatency = enabled;
+    if (enabled)
+    {
+        m_LatencyProfiles.SetPersistPath(persistPath);
+        m_LatencyProfiles.LoadPersisted();
+    }
+}
+
+void FMODAudioSystem::SetCustomAllocatorEnabled(bool enabled, size_t arenaBytes)
+{
+    if (m_Initialized)
+    {
+        std::cerr << "FMOD: The allocator can only be changed before initialization!" << std::endl;
+        return;
+    }
+
+    if (!enabled && AudioAllocator::IsInstalled())
+    {
+        std::cerr << "FMOD: The custom allocator stays installed for the rest of the process." << std::endl;
+    }
+
+    m_UseCustomAllocator = enabled;
+    m_AllocatorArenaBytes = arenaBytes;
+}
+
+void FMODAudioSystem::SetAsyncFileSystemEnabled(bool enabled, int workerThreads)
+{
+    if (m_Initialized)
+    {
+        std::cerr << "FMOD: The file system can only be changed before initialization!" << std::endl;
+        return;
+    }
+
+    m_UseAsyncFileSystem = enabled;
+    m_FileSystemThreads = workerThreads;
+}
+
+void FMODAudioSystem::SetSampleDataOnDemand(bool onDemand, size_t budgetBytes)
+{
+    if (!m_Banks.empty() || !m_PendingBankLoads.empty())
+    {
+        std::cerr << "FMOD: Sample data residency can only be changed before banks are loaded!" << std::endl;
+        return;
+    }
+
+    m_SampleDataOnDemand = onDemand;
+    m_SampleResidency.SetBudget(budgetBytes);
+}
+
+bool FMODAudioSystem::PrefetchEventSampleData(AudioEventId eventId)
+{
+    FMOD::Studio::EventDescription* eventDescription = GetEventDescription(eventId);
+    if (eventDescription == nullptr)
+    {
+        return false;
+    }
+
+    if (m_SampleDataOnDemand)
+    {
+        m_SampleResidency.Touch(eventDescription);
+        return true;
+    }
+
+    // Bank sample data is already resident
+    return true;
+}
+
+AsyncFileSystemStats FMODAudioSystem::GetFileSystemStats() const
+{
+    return m_FileSystem ? m_FileSystem->GetStats() : AsyncFileSystemStats();
+}
+
+bool FMODAudioSystem::LoadBank(const std::string& bankName, const std::string& bankPath, BankLoadMode mode)
 {
     if (!m_Initialized)
     {
@@ -133,293 +389,955 @@ bool FMODAudioSystem::LoadBank(const std::string& bankName, const std::string& b
         return true;
     }
 
+    auto startTime = std::chrono::steady_clock::now();
+
     FMOD::Studio::Bank* bank = nullptr;
-    FMOD_RESULT result = m_StudioSystem->loadBankFile(bankPath.c_str(), FMOD_STUDIO_LOAD_BANK_NORMAL, &bank);
+    FMOD_RESULT result = LoadBankData(bankName, bankPath, mode, FMOD_STUDIO_LOAD_BANK_NORMAL, &bank);
+    if (ErrorCheck(result) != FMOD_OK)
+    {
+        std::cerr << "FMOD: Failed to load bank '" << bankName << "' from path: " << bankPath << std::endl;
+        return false;
+    }
+
+    // Load bank sample data, unless it's loaded per event on first use
+    if (!m_SampleDataOnDemand)
+    {
+        result = bank->loadSampleData();
+        if (ErrorCheck(result) != FMOD_OK)
+        {
+            std::cerr << "FMOD: Failed to load sample data for bank '" << bankName << "'" << std::endl;
+            bank->unload();
+            ReleaseBankMemory(bankName);
+            return false;
+        }
+    }
+
+    m_Banks[bankName] = bank;
+    m_BankSources[bankName] = { bankPath, mode };
+    CacheBankHandles(bank);
+    // On-demand mode would load every pooled event's sample data up front; its pools
+    // fill as one-shots play instead
+    if (IsInstancePoolingEnabled() && !m_SampleDataOnDemand)
+    {
+        m_InstancePools.Prewarm(bank);
+    }
+
+    std::chrono::duration<float, std::milli> loadTime = std::chrono::steady_clock::now() - startTime;
+    std::cout << "FMOD: Successfully loaded bank '" << bankName << "' in " << loadTime.count() << " ms" << std::endl;
+    return true;
+}
+
+BankLoadHandle FMODAudioSystem::LoadBankAsync(const std::string& bankName, const std::string& bankPath, BankLoadMode mode)
+{
+    auto status = std::make_shared<BankLoadStatus>();
+    status->bankName = bankName;
+
+    if (!m_Initialized)
+    {
+        std::cerr << "FMOD: System not initialized!" << std::endl;
+        status->state = BankLoadState::Failed;
+        return status;
+    }
+
+    // Check if bank is already loaded
+    if (m_Banks.find(bankName) != m_Banks.end())
+    {
+        std::cout << "FMOD: Bank '" << bankName << "' already loaded." << std::endl;
+        status->state = BankLoadState::Loaded;
+        return status;
+    }
+
+    // Check if bank is already being loaded
+    for (const auto& pending : m_PendingBankLoads)
+    {
+        if (pending.status->bankName == bankName)
+        {
+            return pending.status;
+        }
+    }
+
+    PendingBankLoad pending;
+    pending.status = status;
+    pending.source = { bankPath, mode };
+    pending.startTime = std::chrono::steady_clock::now();
+
+    // Returns immediately; the bank metadata is read on FMOD's loading thread
+    FMOD_RESULT result = LoadBankData(bankName, bankPath, mode, FMOD_STUDIO_LOAD_BANK_NONBLOCKING, &pending.bank);
+    if (ErrorCheck(result) != FMOD_OK || pending.bank == nullptr)
+    {
+        std::cerr << "FMOD: Failed to load bank '" << bankName << "' from path: " << bankPath << std::endl;
+        status->state = BankLoadState::Failed;
+        return status;
+    }
+
+    m_PendingBankLoads.push_back(pending);
+    return status;
+}
+
+bool FMODAudioSystem::WaitForBankLoads(float timeoutSeconds)
+{
+    // Keep the handles so we can report failures once everything has settled
+    std::vector<std::shared_ptr<BankLoadStatus>> waiting;
+    for (const auto& pending : m_PendingBankLoads)
+    {
+        waiting.push_back(pending.status);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(timeoutSeconds));
+    while (!m_PendingBankLoads.empty())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            for (const auto& pending : m_PendingBankLoads)
+            {
+                std::cerr << "FMOD: Timed out waiting for bank '" << pending.status->bankName << "'" << std::endl;
+            }
+            return false;
+        }
+
+        m_StudioSystem->update();
+        PollBankLoads();
+
+        if (!m_PendingBankLoads.empty())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    bool allLoaded = true;
+    for (const auto& status : waiting)
+    {
+        allLoaded = allLoaded && (status->state == BankLoadState::Loaded);
+    }
+
+    return allLoaded;
+}
+
+void FMODAudioSystem::PollBankLoads()
+{
+    for (size_t i = 0; i < m_PendingBankLoads.size();)
+    {
+        PendingBankLoad& pending = m_PendingBankLoads[i];
+        BankLoadStatus& status = *pending.status;
+
+        FMOD_STUDIO_LOADING_STATE loadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
+        if (status.state == BankLoadState::LoadingMetadata)
+        {
+            pending.bank->getLoadingState(&loadingState);
+            if (loadingState == FMOD_STUDIO_LOADING_STATE_LOADED && !m_SampleDataOnDemand)
+            {
+                // Metadata is in; queue the sample data behind it
+                if (ErrorCheck(pending.bank->loadSampleData()) == FMOD_OK)
+                {
+                    status.state = BankLoadState::LoadingSampleData;
+                    loadingState = FMOD_STUDIO_LOADING_STATE_LOADING;
+                }
+                else
+                {
+                    loadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
+                }
+            }
+        }
+        else
+        {
+            pending.bank->getSampleLoadingState(&loadingState);
+        }
+
+        // With on-demand sample data the bank is done as soon as its metadata is loaded
+        if (loadingState == FMOD_STUDIO_LOADING_STATE_LOADED)
+        {
+            std::chrono::duration<float, std::milli> loadTime = std::chrono::steady_clock::now() - pending.startTime;
+            status.loadTimeMs = loadTime.count();
+            status.state = BankLoadState::Loaded;
+
+            m_Banks[status.bankName] = pending.bank;
+            m_BankSources[status.bankName] = pending.source;
+            CacheBankHandles(pending.bank);
+            if (IsInstancePoolingEnabled() && !m_SampleDataOnDemand)
+            {
+                m_InstancePools.Prewarm(pending.bank);
+            }
+            std::cout << "FMOD: Successfully loaded bank '" << status.bankName << "' in " << status.loadTimeMs << " ms" << std::endl;
+        }
+
+        if (loadingState == FMOD_STUDIO_LOADING_STATE_ERROR)
+        {
+            std::cerr << "FMOD: Failed to load bank '" << status.bankName << "'" << std::endl;
+            pending.bank->unload();
+            ReleaseBankMemory(status.bankName);
+            status.state = BankLoadState::Failed;
+        }
+
+        if (status.IsDone())
+        {
+            m_PendingBankLoads.erase(m_PendingBankLoads.begin() + i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+FMOD_RESULT FMODAudioSystem::LoadBankData(const std::string& bankName, const std::string& bankPath, BankLoadMode mode, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank)
+{
+    if (mode == BankLoadMode::File)
+    {
+        return m_StudioSystem->loadBankFile(bankPath.c_str(), flags, bank);
+    }
+
+    auto mappedFile = std::make_unique<MappedFile>();
+    if (!mappedFile->Open(bankPath))
+    {
+        std::cerr << "FMOD: Failed to map bank file: " << bankPath << std::endl;
+        return FMOD_ERR_FILE_NOTFOUND;
+    }
+
+    // Mappings are page aligned, but FMOD_STUDIO_LOAD_MEMORY_POINT requires it so check anyway
+    if (reinterpret_cast<uintptr_t>(mappedFile->GetData()) % FMOD_STUDIO_LOAD_MEMORY_ALIGNMENT != 0 ||
+        mappedFile->GetSize() > static_cast<size_t>(INT_MAX))
+    {
+        std::cerr << "FMOD: Bank file can't be used in place: " << bankPath << std::endl;
+        return FMOD_ERR_MEMORY_CANTPOINT;
+    }
+
+    FMOD_RESULT result = m_StudioSystem->loadBankMemory(mappedFile->GetData(), static_cast<int>(mappedFile->GetSize()),
+        FMOD_STUDIO_LOAD_MEMORY_POINT, flags, bank);
+    if (result == FMOD_OK)
+    {
+        m_MappedBanks[bankName] = std::move(mappedFile);
+    }
+
+    return result;
+}
+
+void FMODAudioSystem::ReleaseBankMemory(const std::string& bankName)
+{
+    auto it = m_MappedBanks.find(bankName);
+    if (it == m_MappedBanks.end())
+    {
+        return;
+    }
+
+    // FMOD reads the mapping directly, so make sure the unload has been processed first
+    m_StudioSystem->flushCommands();
+    m_MappedBanks.erase(it);
+}
+
+bool FMODAudioSystem::UnloadBank(const std::string& bankName)
+{
+    if (!m_Initialized)
+    {
+        std::cerr << "FMOD: System not initialized!" << std::endl;
+        return false;
+    }
+
+    auto it = m_Banks.find(bankName);
+    if (it == m_Banks.end())
+    {
+        std::cerr << "FMOD: Bank '" << bankName << "' not found!" << std::endl;
+        return false;
+    }
+
+    FMOD_RESULT result = it->second->unload();
     if (ErrorCheck(result) != FMOD_OK)
     {
-        std::cerr << "FMOD: Failed to load bank '" << bankName << "' from path: " << bankPath << std::endl;
+        std::cerr << "FMOD: Failed to unload bank '" << bankName << "'" << std::endl;
+        return false;
+    }
+
+    m_Banks.erase(it);
+    m_BankSources.erase(bankName);
+    ReleaseBankMemory(bankName);
+
+    // Drop cached descriptions that belonged to the unloaded bank
+    m_EventDescriptions.EraseIf([](uint64_t, FMOD::Studio::EventDescription* description) {
+        return !description->isValid();
+    });
+    m_EventMetadata.EraseIf([](uint64_t, const EventMetadata& metadata) {
+        return !metadata.description->isValid();
+    });
+    m_EventParameterIds.EraseIf([](uint64_t, const CachedParameterId& parameter) {
+        return !parameter.description->isValid();
+    });
+
+    // Global parameters may have been defined in the unloaded bank; re-resolve lazily
+    m_GlobalParameterIds.Clear();
+
+    InvalidateHandleCaches();
+    m_SampleResidency.RemoveInvalid();
+    m_InstancePools.RemoveInvalid();
+
+    std::cout << "FMOD: Successfully unloaded bank '" << bankName << "'" << std::endl;
+    return true;
+}
+
+FMOD::Studio::EventInstance* FMODAudioSystem::CreateEventInstance(const std::string& eventPath)
+{
+    return CreateEventInstance(AudioEventId(eventPath));
+}
+
+FMOD::Studio::EventInstance* FMODAudioSystem::CreateEventInstance(AudioEventId eventId)
+{
+    if (!m_Initialized)
+    {
+        std::cerr << "FMOD: System not initialized!" << std::endl;
+        return nullptr;
+    }
+
+    FMOD::Studio::EventDescription* eventDescription = GetEventDescription(eventId);
+    if (eventDescription == nullptr)
+    {
+        return nullptr;
+    }
+
+    FMOD::Studio::EventInstance* eventInstance = CreateInstance(eventDescription);
+    if (eventInstance == nullptr)
+    {
+        std::cerr << "FMOD: Failed to create event instance for '" << eventId.path << "'" << std::endl;
+    }
+
+    return eventInstance;
+}
+
+FMOD::Studio::EventInstance* FMODAudioSystem::CreateInstance(FMOD::Studio::EventDescription* eventDescription)
+{
+    if (m_SampleDataOnDemand)
+    {
+        m_SampleResidency.Touch(eventDescription);
+    }
+
+    // Create the event instance
+    FMOD::Studio::EventInstance* eventInstance = nullptr;
+    FMOD_RESULT result = eventDescription->createInstance(&eventInstance);
+    if (ErrorCheck(result) != FMOD_OK || eventInstance == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (m_SampleDataOnDemand)
+    {
+        m_SampleResidency.OnInstanceCreated(eventDescription, eventInstance);
+    }
+
+    return eventInstance;
+}
+
+FMOD::Studio::EventDescription* FMODAudioSystem::GetEventDescription(AudioEventId eventId)
+{
+    if (!m_Initialized || !eventId.IsValid())
+    {
+        return nullptr;
+    }
+
+    // Check if we already have a cached event description
+    if (FMOD::Studio::EventDescription** cached = m_EventDescriptions.Find(eventId.hash))
+    {
+        return *cached;
+    }
+
+    // FMOD needs a null-terminated path; this only happens on the first lookup
+    std::string eventPath(eventId.path);
+
+    FMOD::Studio::EventDescription* eventDescription = nullptr;
+    FMOD_RESULT result = m_StudioSystem->getEvent(eventPath.c_str(), &eventDescription);
+    if (ErrorCheck(result) != FMOD_OK || eventDescription == nullptr)
+    {
+        std::cerr << "FMOD: Failed to get event description for '" << eventPath << "'" << std::endl;
+        return nullptr;
+    }
+
+    // Cache it for future use
+    m_EventDescriptions.Insert(eventId.hash, eventDescription);
+    return eventDescription;
+}
+
+const FMODAudioSystem::EventMetadata* FMODAudioSystem::GetEventMetadata(AudioEventId eventId)
+{
+    if (const EventMetadata* cached = m_EventMetadata.Find(eventId.hash))
+    {
+        return cached;
+    }
+
+    FMOD::Studio::EventDescription* eventDescription = GetEventDescription(eventId);
+    if (eventDescription == nullptr)
+    {
+        return nullptr;
+    }
+
+    EventMetadata metadata;
+    metadata.description = eventDescription;
+    eventDescription->getMinMaxDistance(&metadata.minDistance, &metadata.maxDistance);
+    eventDescription->is3D(&metadata.is3D);
+    eventDescription->isOneshot(&metadata.isOneshot);
+
+    m_EventMetadata.Insert(eventId.hash, metadata);
+    return m_EventMetadata.Find(eventId.hash);
+}
+
+void FMODAudioSystem::SetOneShotCulling(bool enabled, float distanceMargin)
+{
+    m_CullOneShots = enabled;
+    m_OneShotCullMargin = distanceMargin;
+}
+
+bool FMODAudioSystem::ReleaseEvent(FMOD::Studio::EventInstance* eventInstance)
+{
+    if (!m_Initialized || eventInstance == nullptr)
+    {
+        return false;
+    }
+
+    FMOD_RESULT result = eventInstance->release();
+    return (ErrorCheck(result) == FMOD_OK);
+}
+
+SoundHandle FMODAudioSystem::LoadSound(const std::string& soundPath, bool loop, SoundLoadPolicy policy)
+{
+    if (!m_Initialized)
+    {
+        std::cerr << "FMOD: System not initialized!" << std::endl;
+        return kInvalidSoundHandle;
+    }
+
+    return m_SoundCache.Load(m_CoreSystem, soundPath, loop, policy);
+}
+
+FMOD::Channel* FMODAudioSystem::PlaySound(SoundHandle soundHandle, float volume)
+{
+    if (!m_Initialized || soundHandle == kInvalidSoundHandle)
+    {
+        return nullptr;
+    }
+
+    // Evicted sounds have been released; their handles no longer resolve
+    FMOD::Sound* sound = m_SoundCache.Get(soundHandle);
+    if (sound == nullptr)
+    {
+        std::cerr << "FMOD: Sound is no longer cached, reload it with LoadSound!" << std::endl;
+        return nullptr;
+    }
+
+    // A sound played straight after LoadSound is usually still opening
+    if (!SoundCache::IsReady(sound) && !SoundCache::WaitUntilOpen(sound, 5.0f))
+    {
+        return nullptr;
+    }
+
+    FMOD::Channel* channel = nullptr;
+    FMOD_RESULT result = m_CoreSystem->playSound(sound, nullptr, false, &channel);
+    if (ErrorCheck(result) != FMOD_OK || channel == nullptr)
+    {
+        return nullptr;
+    }
+
+    channel->setVolume(volume);
+    m_SoundCache.OnPlayed(soundHandle, channel);
+    return channel;
+}
+
+FMOD::Channel* FMODAudioSystem::PlaySound(const std::string& soundPath, float volume)
+{
+    return PlaySound(LoadSound(soundPath), volume);
+}
+
+bool FMODAudioSystem::IsSoundReady(SoundHandle sound) const
+{
+    return SoundCache::IsReady(m_SoundCache.Get(sound));
+}
+
+void FMODAudioSystem::SetSoundPolicyThresholds(size_t compressedFromBytes, size_t streamFromBytes)
+{
+    m_SoundCache.SetPolicyThresholds(compressedFromBytes, streamFromBytes);
+}
+
+void FMODAudioSystem::SetSoundCacheBudget(size_t budgetBytes)
+{
+    m_SoundCache.SetBudget(budgetBytes);
+}
+
+bool FMODAudioSystem::PlayOneShot(const std::string& eventPath, const FMOD_VECTOR& position)
+{
+    return PlayOneShot(AudioEventId(eventPath), position);
+}
+
+bool FMODAudioSystem::PlayOneShot(AudioEventId eventId, const FMOD_VECTOR& position)
+{
+    if (!m_Initialized)
+    {
+        return false;
+    }
+
+    const EventMetadata* metadata = GetEventMetadata(eventId);
+    if (metadata == nullptr)
+    {
+        return false;
+    }
+
+    // Nobody would hear it; skip creating an instance at all
+    if (m_CullOneShots && metadata->is3D && metadata->isOneshot)
+    {
+        float cullDistance = metadata->maxDistance + m_OneShotCullMargin;
+        if (m_ActiveListeners.NearestDistanceSquared(position.x, position.y, position.z) > cullDistance * cullDistance)
+        {
+            ++m_OneShotCullStats.culled;
+            return true;
+        }
+    }
+
+    // Batched until the next Update, where merged requests are rate limited
+    if (m_OneShotCoalescer.ShouldDefer(eventId.hash))
+    {
+        m_OneShotCoalescer.Submit(eventId.hash, metadata->description, position);
+        return true;
+    }
+
+    return StartOneShot(metadata->description, position, nullptr, 1);
+}
+
+bool FMODAudioSystem::StartOneShot(FMOD::Studio::EventDescription* eventDescription, const FMOD_VECTOR& position, const OneShotRules* rules, int count)
+{
+    ++m_OneShotCullStats.played;
+
+    // Pooled instances go back to their pool when they stop instead of being released
+    bool pooled = IsInstancePoolingEnabled();
+
+    FMOD::Studio::EventInstance* eventInstance = nullptr;
+    if (pooled)
+    {
+        if (m_SampleDataOnDemand)
+        {
+            m_SampleResidency.Touch(eventDescription);
+        }
+
+        eventInstance = m_InstancePools.Acquire(eventDescription);
+
+        // Only measures the first instance of each description
+        if (m_SampleDataOnDemand && eventInstance != nullptr)
+        {
+            m_SampleResidency.OnInstanceCreated(eventDescription, eventInstance);
+        }
+    }
+    else
+    {
+        eventInstance = CreateInstance(eventDescription);
+    }
+
+    if (eventInstance == nullptr)
+    {
+        return false;
+    }
+
+    // Tell the event how many requests it stands in for. Without rules the parameter
+    // keeps its default; a reused pooled instance was reset to it by Acquire.
+    if (rules != nullptr && !rules->countParameter.empty())
+    {
+        FMOD_STUDIO_PARAMETER_ID parameterId;
+        if (GetEventParameterId(eventDescription, rules->countParameter, parameterId))
+        {
+            eventInstance->setParameterByID(parameterId, static_cast<float>(count));
+        }
+    }
+
+    // Create a fully initialized FMOD_3D_ATTRIBUTES structure
+    FMOD_3D_ATTRIBUTES attributes = {};
+    attributes.position = position;
+    attributes.velocity = { 0.0f, 0.0f, 0.0f };  // Initialize velocity
+    attributes.forward = { 0.0f, 0.0f, 1.0f };   // Forward vector (z-axis)
+    attributes.up = { 0.0f, 1.0f, 0.0f };        // Up vector (y-axis)
+
+    // Set the 3D attributes and start the event
+    FMOD_RESULT result = eventInstance->set3DAttributes(&attributes);
+    if (ErrorCheck(result) == FMOD_OK)
+    {
+        result = eventInstance->start();
+        ErrorCheck(result);
+    }
+
+    if (pooled)
+    {
+        if (result != FMOD_OK)
+        {
+            m_InstancePools.Recycle(eventInstance);
+        }
+        return (result == FMOD_OK);
+    }
+
+    if (result != FMOD_OK)
+    {
+        eventInstance->release();
+        return false;
+    }
+
+    // Set to automatically release when done
+    result = eventInstance->release();
+    return (ErrorCheck(result) == FMOD_OK);
+}
+
+void FMODAudioSystem::FlushOneShots()
+{
+    for (const CoalescedOneShot& request : m_OneShotCoalescer.Flush())
+    {
+        // The bank may have been unloaded since the request was made
+        if (!request.description->isValid())
+        {
+            continue;
+        }
+
+        StartOneShot(request.description, request.position, m_OneShotCoalescer.GetRules(request.hash), request.count);
+    }
+}
+
+void FMODAudioSystem::SetOneShotCoalescing(bool enabled, float radius)
+{
+    m_OneShotCoalescer.SetCoalescing(enabled, radius);
+}
+
+void FMODAudioSystem::SetOneShotRules(AudioEventId eventId, const OneShotRules& rules)
+{
+    m_OneShotCoalescer.SetRules(eventId.hash, rules);
+}
+
+void FMODAudioSystem::ClearOneShotRules(AudioEventId eventId)
+{
+    m_OneShotCoalescer.ClearRules(eventId.hash);
+}
+
+void FMODAudioSystem::Set3DListenerPosition(float x, float y)
+{
+    Set3DListenerPosition(0, x, y);
+}
+
+void FMODAudioSystem::Set3DListenerPosition(int listener, float x, float y)
+{
+    if (!m_Initialized) return;
+
+    if (listener < 0 || listener >= m_NumListeners)
+    {
+        std::cerr << "FMOD: Listener " << listener << " out of range!" << std::endl;
+        return;
+    }
+
+    FMOD_3D_ATTRIBUTES listenerAttributes;
+    listenerAttributes.position = { x, y, 0 };
+    listenerAttributes.velocity = { 0, 0, 0 };
+    listenerAttributes.forward = { 0, 0, 1 };  // Forward direction (z-axis)
+    listenerAttributes.up = { 0, 1, 0 };       // Up direction (y-axis)
+
+    // Remembered for culling and voice scoring
+    m_Listeners[listener].position = listenerAttributes.position;
+    RebuildActiveListeners();
+
+    // Update Studio System listener
+    FMOD_RESULT result = m_StudioSystem->setListenerAttributes(listener, &listenerAttributes);
+    ErrorCheck(result);
+}
+
+bool FMODAudioSystem::SetNumListeners(int numListeners)
+{
+    if (numListeners < 1 || numListeners > FMOD_MAX_LISTENERS)
+    {
+        std::cerr << "FMOD: Listener count must be between 1 and " << FMOD_MAX_LISTENERS << "!" << std::endl;
         return false;
     }
 
-    // Load bank sample data
-    result = bank->loadSampleData();
-    if (ErrorCheck(result) != FMOD_OK)
+    if (m_Initialized && ErrorCheck(m_StudioSystem->setNumListeners(numListeners)) != FMOD_OK)
     {
-        std::cerr << "FMOD: Failed to load sample data for bank '" << bankName << "'" << std::endl;
-        bank->unload();
         return false;
     }
 
-    m_Banks[bankName] = bank;
-    std::cout << "FMOD: Successfully loaded bank '" << bankName << "'" << std::endl;
+    m_NumListeners = numListeners;
+    RebuildActiveListeners();
     return true;
 }
 
-bool FMODAudioSystem::UnloadBank(const std::string& bankName)
+bool FMODAudioSystem::SetListenerWeight(int listener, float weight)
 {
-    if (!m_Initialized)
-    {
-        std::cerr << "FMOD: System not initialized!" << std::endl;
-        return false;
-    }
-
-    auto it = m_Banks.find(bankName);
-    if (it == m_Banks.end())
+    if (listener < 0 || listener >= m_NumListeners)
     {
-        std::cerr << "FMOD: Bank '" << bankName << "' not found!" << std::endl;
+        std::cerr << "FMOD: Listener " << listener << " out of range!" << std::endl;
         return false;
     }
 
-    FMOD_RESULT result = it->second->unload();
-    if (ErrorCheck(result) != FMOD_OK)
+    if (m_Initialized && ErrorCheck(m_StudioSystem->setListenerWeight(listener, weight)) != FMOD_OK)
     {
-        std::cerr << "FMOD: Failed to unload bank '" << bankName << "'" << std::endl;
         return false;
     }
 
-    m_Banks.erase(it);
-    std::cout << "FMOD: Successfully unloaded bank '" << bankName << "'" << std::endl;
+    m_Listeners[listener].weight = weight;
+    RebuildActiveListeners();
     return true;
 }
 
-FMOD::Studio::EventInstance* FMODAudioSystem::CreateEventInstance(const std::string& eventPath)
+void FMODAudioSystem::RebuildActiveListeners()
 {
-    if (!m_Initialized)
-    {
-        std::cerr << "FMOD: System not initialized!" << std::endl;
-        return nullptr;
-    }
-
-    // Check if we already have a cached event description
-    FMOD::Studio::EventDescription* eventDescription = nullptr;
-    auto descIt = m_EventDescriptions.find(eventPath);
-
-    if (descIt != m_EventDescriptions.end())
+    m_ActiveListeners.count = 0;
+    for (int i = 0; i < m_NumListeners; ++i)
     {
-        eventDescription = descIt->second;
-    }
-    else
-    {
-        // Get the event description
-        FMOD_RESULT result = m_StudioSystem->getEvent(eventPath.c_str(), &eventDescription);
-        if (ErrorCheck(result) != FMOD_OK || eventDescription == nullptr)
+        if (m_Listeners[i].weight > 0.0f)
         {
-            std::cerr << "FMOD: Failed to get event description for '" << eventPath << "'" << std::endl;
-            return nullptr;
+            m_ActiveListeners.x[m_ActiveListeners.count] = m_Listeners[i].position.x;
+            m_ActiveListeners.y[m_ActiveListeners.count] = m_Listeners[i].position.y;
+            ++m_ActiveListeners.count;
         }
-
-        // Cache it for future use
-        m_EventDescriptions[eventPath] = eventDescription;
     }
 
-    // Create the event instance
-    FMOD::Studio::EventInstance* eventInstance = nullptr;
-    FMOD_RESULT result = eventDescription->createInstance(&eventInstance);
-    if (ErrorCheck(result) != FMOD_OK || eventInstance == nullptr)
+    // Every listener faded out; fall back to the first so distances stay defined
+    if (m_ActiveListeners.count == 0)
     {
-        std::cerr << "FMOD: Failed to create event instance for '" << eventPath << "'" << std::endl;
-        return nullptr;
+        m_ActiveListeners.x[0] = m_Listeners[0].position.x;
+        m_ActiveListeners.y[0] = m_Listeners[0].position.y;
+        m_ActiveListeners.count = 1;
     }
-
-    return eventInstance;
 }
 
-bool FMODAudioSystem::ReleaseEvent(FMOD::Studio::EventInstance* eventInstance)
+EmitterId FMODAudioSystem::RegisterEmitter(FMOD::Studio::EventInstance* eventInstance, float x, float y)
 {
     if (!m_Initialized || eventInstance == nullptr)
     {
-        return false;
+        return kInvalidEmitterId;
     }
 
-    FMOD_RESULT result = eventInstance->release();
-    return (ErrorCheck(result) == FMOD_OK);
+    return m_Emitters.Add(eventInstance, x, y);
 }
 
-FMOD::Sound* FMODAudioSystem::LoadSound(const std::string& soundPath, bool loop)
+ReverbZoneId FMODAudioSystem::AddReverbZone(float x, float y, float minDistance, float maxDistance, const FMOD_REVERB_PROPERTIES& properties)
 {
-    if (!m_Initialized)
+    // Zones may be added before Initialize; Reverb3D objects are only created in Update
+    return m_ReverbZones.AddZone(x, y, minDistance, maxDistance, properties);
+}
+
+void FMODAudioSystem::Set3DEventPosition(FMOD::Studio::EventInstance* eventInstance, float x, float y)
+{
+    if (!m_Initialized || eventInstance == nullptr)
     {
-        std::cerr << "FMOD: System not initialized!" << std::endl;
-        return nullptr;
+        return;
     }
 
-    // Check if sound is already loaded
-    auto it = m_Sounds.find(soundPath);
-    if (it != m_Sounds.end())
-    {
-        return it->second;
+    FMOD_3D_ATTRIBUTES attributes;
+    FMOD_VECTOR position = { x, y, 0 };
+    FMOD_VECTOR velocity = { 0.0f, 0.0f, 0.0f };
+    // Use default forward and up vectors for the event source.
+    FMOD_VECTOR forward = { 0.0f, 0.0f, 1.0f };
+    FMOD_VECTOR up = { 0.0f, 1.0f, 0.0f };
+
+    attributes.position = position;
+    attributes.velocity = velocity;
+    attributes.forward = forward;
+    attributes.up = up;
+
+    FMOD_RESULT result = eventInstance->set3DAttributes(&attributes);
+
+    // Verify position was set by reading it back
+    FMOD_3D_ATTRIBUTES verifyAttributes;
+    result = eventInstance->get3DAttributes(&verifyAttributes);
+    if (result == FMOD_OK) {
+        std::cout << "Verified position: " << verifyAttributes.position.x
+            << ", " << verifyAttributes.position.y << std::endl;
     }
 
-    FMOD::Sound* sound = nullptr;
-    FMOD_MODE mode = FMOD_DEFAULT;
-    if (loop)
+    ErrorCheck(result);
+}
+
+
+bool FMODAudioSystem::SetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName, float value)
+{
+    if (!m_Initialized || eventInstance == nullptr)
     {
-        mode |= FMOD_LOOP_NORMAL;
+        return false;
     }
 
-    FMOD_RESULT result = m_CoreSystem->createSound(soundPath.c_str(), mode, nullptr, &sound);
-    if (ErrorCheck(result) != FMOD_OK || sound == nullptr)
+    FMOD_STUDIO_PARAMETER_ID parameterId;
+    if (!GetEventParameterId(eventInstance, parameterName, parameterId))
     {
-        std::cerr << "FMOD: Failed to load sound '" << soundPath << "'" << std::endl;
-        return nullptr;
+        return false;
     }
 
-    m_Sounds[soundPath] = sound;
-    return sound;
+    return SetEventParameterById(eventInstance, parameterId, value);
 }
 
-FMOD::Channel* FMODAudioSystem::PlaySound(FMOD::Sound* sound, float volume)
+float FMODAudioSystem::GetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName)
 {
-    if (!m_Initialized || sound == nullptr)
+    if (!m_Initialized || eventInstance == nullptr)
     {
-        return nullptr;
+        return 0.0f;
     }
 
-    FMOD::Channel* channel = nullptr;
-    FMOD_RESULT result = m_CoreSystem->playSound(sound, nullptr, false, &channel);
-    if (ErrorCheck(result) != FMOD_OK || channel == nullptr)
+    FMOD_STUDIO_PARAMETER_ID parameterId;
+    if (!GetEventParameterId(eventInstance, parameterName, parameterId))
     {
-        return nullptr;
+        return 0.0f;
     }
 
-    channel->setVolume(volume);
-    return channel;
+    return GetEventParameterById(eventInstance, parameterId);
 }
 
-bool FMODAudioSystem::PlayOneShot(const std::string& eventPath, const FMOD_VECTOR& position)
+bool FMODAudioSystem::GetEventParameterId(FMOD::Studio::EventDescription* eventDescription, const std::string& parameterName, FMOD_STUDIO_PARAMETER_ID& parameterId)
 {
-    if (!m_Initialized)
+    if (!m_Initialized || eventDescription == nullptr)
     {
         return false;
     }
 
-    FMOD::Studio::EventInstance* eventInstance = CreateEventInstance(eventPath);
-    if (eventInstance == nullptr)
+    // Mix the description pointer into the name hash so each description has its own entries
+    uint64_t key = HashAudioPath(parameterName) ^ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(eventDescription)) * 0x9e3779b97f4a7c15ull);
+
+    // On a hash collision the entry belongs to another parameter; resolve and replace it
+    CachedParameterId* cached = m_EventParameterIds.Find(key);
+    if (cached != nullptr && cached->description == eventDescription && cached->name == parameterName)
+    {
+        parameterId = cached->id;
+        return true;
+    }
+
+    FMOD_STUDIO_PARAMETER_DESCRIPTION parameterDescription;
+    FMOD_RESULT result = eventDescription->getParameterDescriptionByName(parameterName.c_str(), &parameterDescription);
+    if (ErrorCheck(result) != FMOD_OK)
     {
+        std::cerr << "FMOD: Failed to find event parameter '" << parameterName << "'" << std::endl;
         return false;
     }
 
-    // Create a fully initialized FMOD_3D_ATTRIBUTES structure
-    FMOD_3D_ATTRIBUTES attributes = {};
-    attributes.position = position;
-    attributes.velocity = { 0.0f, 0.0f, 0.0f };  // Initialize velocity
-    attributes.forward = { 0.0f, 0.0f, 1.0f };   // Forward vector (z-axis)
-    attributes.up = { 0.0f, 1.0f, 0.0f };        // Up vector (y-axis)
+    CachedParameterId entry;
+    entry.description = eventDescription;
+    entry.name = parameterName;
+    entry.id = parameterDescription.id;
+    m_EventParameterIds.Insert(key, entry);
 
-    // Set the 3D attributes
-    FMOD_RESULT result = eventInstance->set3DAttributes(&attributes);
-    if (ErrorCheck(result) != FMOD_OK)
+    parameterId = parameterDescription.id;
+    return true;
+}
+
+bool FMODAudioSystem::GetEventParameterId(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName, FMOD_STUDIO_PARAMETER_ID& parameterId)
+{
+    if (!m_Initialized || eventInstance == nullptr)
     {
-        eventInstance->release();
         return false;
     }
 
-    // Start the event
-    result = eventInstance->start();
+    FMOD::Studio::EventDescription* eventDescription = nullptr;
+    FMOD_RESULT result = eventInstance->getDescription(&eventDescription);
     if (ErrorCheck(result) != FMOD_OK)
     {
-        eventInstance->release();
         return false;
     }
 
-    // Set to automatically release when done
-    result = eventInstance->release();
-    return (ErrorCheck(result) == FMOD_OK);
+    return GetEventParameterId(eventDescription, parameterName, parameterId);
 }
 
-void FMODAudioSystem::Set3DListenerPosition(float x, float y)
+bool FMODAudioSystem::SetEventParameterById(FMOD::Studio::EventInstance* eventInstance, FMOD_STUDIO_PARAMETER_ID parameterId, float value)
 {
-    if (!m_Initialized) return;
+    if (!m_Initialized || eventInstance == nullptr)
+    {
+        return false;
+    }
 
-    FMOD_3D_ATTRIBUTES listenerAttributes;
-    listenerAttributes.position = { x, y, 0 };
-    listenerAttributes.velocity = { 0, 0, 0 };
-    listenerAttributes.forward = { 0, 0, 1 };  // Forward direction (z-axis)
-    listenerAttributes.up = { 0, 1, 0 };       // Up direction (y-axis)
+    FMOD_RESULT result = eventInstance->setParameterByID(parameterId, value);
+    return (ErrorCheck(result) == FMOD_OK);
+}
+
+float FMODAudioSystem::GetEventParameterById(FMOD::Studio::EventInstance* eventInstance, FMOD_STUDIO_PARAMETER_ID parameterId)
+{
+    if (!m_Initialized || eventInstance == nullptr)
+    {
+        return 0.0f;
+    }
 
-    // Update Studio System listener (index 0)
-    FMOD_RESULT result = m_StudioSystem->setListenerAttributes(0, &listenerAttributes);
+    float value = 0.0f;
+    FMOD_RESULT result = eventInstance->getParameterByID(parameterId, &value);
     ErrorCheck(result);
 
-    // Optional: Verify the position via Studio System
-    FMOD_3D_ATTRIBUTES verifyAttrs;
-    result = m_StudioSystem->getListenerAttributes(0, &verifyAttrs);
-    if (result == FMOD_OK) {
-        std::cout << "Studio Listener Position: " << verifyAttrs.position.x
-            << ", " << verifyAttrs.position.y << std::endl;
+    return value;
+}
+
+bool FMODAudioSystem::SetEventParametersByIds(FMOD::Studio::EventInstance* eventInstance, const FMOD_STUDIO_PARAMETER_ID* parameterIds, float* values, int count)
+{
+    if (!m_Initialized || eventInstance == nullptr || parameterIds == nullptr || values == nullptr || count <= 0)
+    {
+        return false;
     }
+
+    // One API call for the whole batch
+    FMOD_RESULT result = eventInstance->setParametersByIDs(parameterIds, values, count);
+    return (ErrorCheck(result) == FMOD_OK);
 }
 
-void FMODAudioSystem::Set3DEventPosition(FMOD::Studio::EventInstance* eventInstance, float x, float y)
+bool FMODAudioSystem::SetGlobalParameter(const std::string& parameterName, float value)
 {
-    if (!m_Initialized || eventInstance == nullptr)
+    if (!m_Initialized)
     {
-        return;
+        return false;
     }
 
-    FMOD_3D_ATTRIBUTES attributes;
-    FMOD_VECTOR position = { x, y, 0 };
-    FMOD_VECTOR velocity = { 0.0f, 0.0f, 0.0f };
-    // Use default forward and up vectors for the event source.
-    FMOD_VECTOR forward = { 0.0f, 0.0f, 1.0f };
-    FMOD_VECTOR up = { 0.0f, 1.0f, 0.0f };
+    FMOD_STUDIO_PARAMETER_ID parameterId;
+    if (!GetGlobalParameterId(parameterName, parameterId))
+    {
+        return false;
+    }
 
-    attributes.position = position;
-    attributes.velocity = velocity;
-    attributes.forward = forward;
-    attributes.up = up;
+    return SetGlobalParameterById(parameterId, value);
+}
 
-    FMOD_RESULT result = eventInstance->set3DAttributes(&attributes);
+float FMODAudioSystem::GetGlobalParameter(const std::string& parameterName)
+{
+    if (!m_Initialized)
+    {
+        return 0.0f;
+    }
 
-    // Verify position was set by reading it back
-    FMOD_3D_ATTRIBUTES verifyAttributes;
-    result = eventInstance->get3DAttributes(&verifyAttributes);
-    if (result == FMOD_OK) {
-        std::cout << "Verified position: " << verifyAttributes.position.x
-            << ", " << verifyAttributes.position.y << std::endl;
+    FMOD_STUDIO_PARAMETER_ID parameterId;
+    if (!GetGlobalParameterId(parameterName, parameterId))
+    {
+        return 0.0f;
     }
 
-    ErrorCheck(result);
+    return GetGlobalParameterById(parameterId);
 }
 
-
-bool FMODAudioSystem::SetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName, float value)
+bool FMODAudioSystem::GetGlobalParameterId(const std::string& parameterName, FMOD_STUDIO_PARAMETER_ID& parameterId)
 {
-    if (!m_Initialized || eventInstance == nullptr)
+    if (!m_Initialized)
     {
         return false;
     }
 
-    FMOD_RESULT result = eventInstance->setParameterByName(parameterName.c_str(), value);
-    return (ErrorCheck(result) == FMOD_OK);
-}
+    uint64_t key = HashAudioPath(parameterName);
+    CachedParameterId* cached = m_GlobalParameterIds.Find(key);
+    if (cached != nullptr && cached->name == parameterName)
+    {
+        parameterId = cached->id;
+        return true;
+    }
 
-float FMODAudioSystem::GetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName)
-{
-    if (!m_Initialized || eventInstance == nullptr)
+    FMOD_STUDIO_PARAMETER_DESCRIPTION parameterDescription;
+    FMOD_RESULT result = m_StudioSystem->getParameterDescriptionByName(parameterName.c_str(), &parameterDescription);
+    if (ErrorCheck(result) != FMOD_OK)
     {
-        return 0.0f;
+        std::cerr << "FMOD: Failed to find global parameter '" << parameterName << "'" << std::endl;
+        return false;
     }
 
-    float value = 0.0f;
-    FMOD_RESULT result = eventInstance->getParameterByName(parameterName.c_str(), &value);
-    ErrorCheck(result);
+    CachedParameterId entry;
+    entry.name = parameterName;
+    entry.id = parameterDescription.id;
+    m_GlobalParameterIds.Insert(key, entry);
 
-    return value;
+    parameterId = parameterDescription.id;
+    return true;
 }
 
-bool FMODAudioSystem::SetGlobalParameter(const std::string& parameterName, float value)
+bool FMODAudioSystem::SetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value)
 {
     if (!m_Initialized)
     {
         return false;
     }
 
-    FMOD_RESULT result = m_StudioSystem->setParameterByName(parameterName.c_str(), value);
+    FMOD_RESULT result = m_StudioSystem->setParameterByID(parameterId, value);
     return (ErrorCheck(result) == FMOD_OK);
 }
 
-float FMODAudioSystem::GetGlobalParameter(const std::string& parameterName)
+float FMODAudioSystem::GetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId)
 {
     if (!m_Initialized)
     {
@@ -427,12 +1345,23 @@ float FMODAudioSystem::GetGlobalParameter(const std::string& parameterName)
     }
 
     float value = 0.0f;
-    FMOD_RESULT result = m_StudioSystem->getParameterByName(parameterName.c_str(), &value);
+    FMOD_RESULT result = m_StudioSystem->getParameterByID(parameterId, &value);
     ErrorCheck(result);
 
     return value;
 }
 
+bool FMODAudioSystem::SetGlobalParametersByIds(const FMOD_STUDIO_PARAMETER_ID* parameterIds, float* values, int count)
+{
+    if (!m_Initialized || parameterIds == nullptr || values == nullptr || count <= 0)
+    {
+        return false;
+    }
+
+    FMOD_RESULT result = m_StudioSystem->setParametersByIDs(parameterIds, values, count);
+    return (ErrorCheck(result) == FMOD_OK);
+}
+
 FMOD::Studio::Bus* FMODAudioSystem::GetBus(const std::string& busPath)
 {
     if (!m_Initialized)
@@ -440,6 +1369,15 @@ FMOD::Studio::Bus* FMODAudioSystem::GetBus(const std::string& busPath)
         return nullptr;
     }
 
+    uint64_t key = HashAudioPath(busPath);
+    if (FMOD::Studio::Bus** cached = m_Buses.Find(key))
+    {
+        ++m_BusCacheStats.hits;
+        return *cached;
+    }
+
+    ++m_BusCacheStats.misses;
+
     FMOD::Studio::Bus* bus = nullptr;
     FMOD_RESULT result = m_StudioSystem->getBus(busPath.c_str(), &bus);
     if (ErrorCheck(result) != FMOD_OK)
@@ -447,6 +1385,7 @@ FMOD::Studio::Bus* FMODAudioSystem::GetBus(const std::string& busPath)
         return nullptr;
     }
 
+    m_Buses.Insert(key, bus);
     return bus;
 }
 
@@ -511,6 +1450,15 @@ FMOD::Studio::VCA* FMODAudioSystem::GetVCA(const std::string& vcaPath)
         return nullptr;
     }
 
+    uint64_t key = HashAudioPath(vcaPath);
+    if (FMOD::Studio::VCA** cached = m_VCAs.Find(key))
+    {
+        ++m_VCACacheStats.hits;
+        return *cached;
+    }
+
+    ++m_VCACacheStats.misses;
+
     FMOD::Studio::VCA* vca = nullptr;
     FMOD_RESULT result = m_StudioSystem->getVCA(vcaPath.c_str(), &vca);
     if (ErrorCheck(result) != FMOD_OK)
@@ -518,6 +1466,7 @@ FMOD::Studio::VCA* FMODAudioSystem::GetVCA(const std::string& vcaPath)
         return nullptr;
     }
 
+    m_VCAs.Insert(key, vca);
     return vca;
 }
 
@@ -617,7 +1566,99 @@ void FMODAudioSystem::Update()
         return;
     }
 
+    // Start this frame's batched one-shots in the same update as everything else
+    FlushOneShots();
+
+    if (m_Emitters.GetCount() > 0)
+    {
+        m_Emitters.Flush(m_ActiveListeners);
+    }
+
+    m_ReverbZones.Update(m_CoreSystem, m_ActiveListeners);
+
+    auto studioUpdateStart = std::chrono::steady_clock::now();
     m_StudioSystem->update();
+    std::chrono::duration<float, std::milli> studioUpdateTime = std::chrono::steady_clock::now() - studioUpdateStart;
+    m_LastStudioUpdateMs = studioUpdateTime.count();
+
+    if (!m_PendingBankLoads.empty())
+    {
+        PollBankLoads();
+    }
+
+    if (m_SampleDataOnDemand)
+    {
+        // Idle pooled instances would otherwise keep cold descriptions resident forever
+        m_SampleResidency.Update([this](FMOD::Studio::EventDescription* description) {
+            return m_InstancePools.ReleaseIdle(description);
+        });
+    }
+
+    m_SoundCache.Update();
+    m_InstancePools.Update();
+    m_Telemetry.Update(m_StudioSystem, m_CoreSystem, m_EventDescriptions);
+
+    // Move to a larger DSP buffer if the mixer can't keep up with this one. This may be
+    // the audio thread, so the restart itself waits for ApplyPendingRestart.
+    if (m_AdaptiveLatency && !m_RestartPending && m_LatencyProfiles.Update(m_CoreSystem) && m_LatencyProfiles.StepUp())
+    {
+        const DSPBufferProfile& profile = m_LatencyProfiles.GetCurrentProfile();
+        std::cout << "FMOD: Mixer starving, switching to a " << profile.bufferLength << " x " << profile.numBuffers << " DSP buffer." << std::endl;
+
+        m_LatencyProfiles.SavePersisted();
+        m_RestartPending = true;
+    }
+}
+
+void FMODAudioSystem::CacheBankHandles(FMOD::Studio::Bank* bank)
+{
+    // Eagerly cache the bank's buses and VCAs. Paths are only available once the
+    // strings bank is loaded; anything skipped here is cached lazily on first use.
+    std::string path;
+
+    int count = 0;
+    if (bank->getBusCount(&count) == FMOD_OK && count > 0)
+    {
+        std::vector<FMOD::Studio::Bus*> buses(count);
+        if (bank->getBusList(buses.data(), count, &count) == FMOD_OK)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                if (GetHandlePath(buses[i], path))
+                {
+                    m_Buses.Insert(HashAudioPath(path), buses[i]);
+                }
+            }
+        }
+    }
+
+    count = 0;
+    if (bank->getVCACount(&count) == FMOD_OK && count > 0)
+    {
+        std::vector<FMOD::Studio::VCA*> vcas(count);
+        if (bank->getVCAList(vcas.data(), count, &count) == FMOD_OK)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                if (GetHandlePath(vcas[i], path))
+                {
+                    m_VCAs.Insert(HashAudioPath(path), vcas[i]);
+                }
+            }
+        }
+    }
+}
+
+void FMODAudioSystem::InvalidateHandleCaches()
+{
+    // A bus or VCA can be shared by several banks, so only drop the handles
+    // that actually became invalid with the unload
+    m_BusCacheStats.evictions += m_Buses.EraseIf([](uint64_t, FMOD::Studio::Bus* bus) {
+        return !bus->isValid();
+    });
+    m_VCACacheStats.evictions += m_VCAs.EraseIf([](uint64_t, FMOD::Studio::VCA* vca) {
+        return !vca->isValid();
+    });
 }
 
 FMOD_RESULT FMODAudioSystem::ErrorCheck(FMOD_RESULT result) const
@@ -8,7 +8,63 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <chrono>
 #include <fmod_errors.h>
+#include "AudioEventId.h"
+#include "AudioCacheStats.h"
+#include "HashedHandleTable.h"
+#include "MappedFile.h"
+#include "AsyncFileSystem.h"
+#include "SampleResidencyManager.h"
+#include "AudioAllocator.h"
+#include "LatencyProfileManager.h"
+#include "SoundCache.h"
+#include "EventInstancePool.h"
+#include "OneShotCoalescer.h"
+#include "EmitterStore.h"
+#include "AudioListenerSet.h"
+#include "ReverbZoneManager.h"
+#include "AudioTelemetry.h"
+
+// How bank files are read into FMOD
+enum class BankLoadMode
+{
+    File,         // loadBankFile through FMOD's file layer
+    MemoryMapped  // Map the file and point loadBankMemory at it (no private copy)
+};
+
+// Progress of a bank issued through LoadBankAsync. Updated by FMODAudioSystem::Update.
+enum class BankLoadState
+{
+    LoadingMetadata,
+    LoadingSampleData,
+    Loaded,
+    Failed
+};
+
+struct BankLoadStatus
+{
+    std::string bankName;
+    BankLoadState state = BankLoadState::LoadingMetadata;
+    float loadTimeMs = 0.0f; // From issue until sample data (or, on demand, metadata) is resident
+
+    bool IsDone() const { return state == BankLoadState::Loaded || state == BankLoadState::Failed; }
+};
+
+using BankLoadHandle = std::shared_ptr<const BankLoadStatus>;
+
+// Counters for PlayOneShot audibility culling
+struct OneShotCullStats
+{
+    uint64_t played = 0;
+    uint64_t culled = 0;
+
+    float GetCullRate() const
+    {
+        uint64_t total = played + culled;
+        return (total > 0) ? static_cast<float>(culled) / static_cast<float>(total) : 0.0f;
+    }
+};
 
 class FMODAudioSystem
 {
@@ -25,31 +81,155 @@ public:
     bool Initialize(int maxChannels = 32, int studioFlags = FMOD_STUDIO_INIT_NORMAL, int coreFlags = FMOD_INIT_NORMAL);
     void Shutdown();
 
+    // Shuts down and re-initializes with the same settings, reloading banks and snapshots.
+    // Event instances created before the restart become invalid, as do registered
+    // emitters; the restart callback runs afterwards so their owners can recreate them.
+    bool Restart();
+    void SetRestartCallback(std::function<void()> callback) { m_RestartCallback = std::move(callback); }
+
+    // Restarts requested by Update are deferred to a safe point: the owner of the
+    // update loop calls ApplyPendingRestart, outside Update and with no other thread
+    // using FMOD (GameAudioManager does this at the start of its Update).
+    bool IsRestartPending() const { return m_RestartPending; }
+    bool ApplyPendingRestart();
+
+    // Opt-in adaptive DSP buffer sizing: start at low latency and step up (with a Restart)
+    // when the mixer starves. Must be set before Initialize. The restart is deferred
+    // (see ApplyPendingRestart).
+    void SetAdaptiveLatencyEnabled(bool enabled, const std::string& persistPath = "audio_latency_profile.cfg");
+    const LatencyProfileManager& GetLatencyProfiles() const { return m_LatencyProfiles; }
+
+    // Opt-in pooled allocator for all FMOD memory; must be set before the first Initialize
+    void SetCustomAllocatorEnabled(bool enabled, size_t arenaBytes = 4 * 1024 * 1024);
+
+    // Opt-in prioritized async file I/O; must be set before Initialize
+    void SetAsyncFileSystemEnabled(bool enabled, int workerThreads = 2);
+    bool IsAsyncFileSystemEnabled() const { return m_FileSystem != nullptr; }
+    AsyncFileSystemStats GetFileSystemStats() const;
+
     // Bank loading
-    bool LoadBank(const std::string& bankName, const std::string& bankPath);
+    bool LoadBank(const std::string& bankName, const std::string& bankPath, BankLoadMode mode = BankLoadMode::File);
     bool UnloadBank(const std::string& bankName);
 
+    // Non-blocking bank loading. The returned handle is completed by Update().
+    BankLoadHandle LoadBankAsync(const std::string& bankName, const std::string& bankPath, BankLoadMode mode = BankLoadMode::File);
+    bool IsLoadingBanks() const { return !m_PendingBankLoads.empty(); }
+
+    // Drives pending loads until they finish or the timeout passes. Returns false if a
+    // bank failed or is still loading; loads that timed out keep being polled by Update().
+    bool WaitForBankLoads(float timeoutSeconds = 30.0f);
+
+    // Sample data residency. By default LoadBank loads all of a bank's sample data;
+    // on-demand mode loads it per event on first use and evicts cold events over budget.
+    // Must be set before any bank is loaded.
+    void SetSampleDataOnDemand(bool onDemand, size_t budgetBytes = 64 * 1024 * 1024);
+    bool PrefetchEventSampleData(AudioEventId eventId);
+    SampleResidencyStats GetSampleResidencyStats() const { return m_SampleResidency.GetStats(); }
+
+    // PlayOneShot instance pooling: each one-shot event gets this many instances created
+    // when its bank loads, and PlayOneShot reuses them as they stop. 0 (the default)
+    // disables pooling. In sample-data-on-demand mode pools aren't pre-warmed, and a
+    // description's idle instances are released when its sample data is due for eviction.
+    void SetEventInstancePoolSize(int instancesPerEvent) { m_InstancePools.SetPoolSize(instancesPerEvent); }
+    EventInstancePoolStats GetEventInstancePoolStats() const { return m_InstancePools.GetStats(); }
+
     // Events
     FMOD::Studio::EventInstance* CreateEventInstance(const std::string& eventPath);
+    FMOD::Studio::EventInstance* CreateEventInstance(AudioEventId eventId);
+    FMOD::Studio::EventDescription* GetEventDescription(AudioEventId eventId);
     bool ReleaseEvent(FMOD::Studio::EventInstance* eventInstance);
 
-    // Sound playback (for simple one-shot sounds)
-    FMOD::Sound* LoadSound(const std::string& soundPath, bool loop = false);
-    FMOD::Channel* PlaySound(FMOD::Sound* sound, float volume = 1.0f);
+    // Sound playback (for simple one-shot sounds). Sounds open in the background and
+    // live in a byte-budgeted LRU cache; a sound is pinned while a channel from
+    // PlaySound plays it. LoadSound returns a handle that stops resolving once the
+    // sound is evicted (PlaySound then fails; load it again). Playing a sound that is
+    // still opening waits for the open, like the blocking load did, so
+    // PlaySound(LoadSound(path)) works on first use; poll IsSoundReady to avoid the
+    // wait. A streamed sound can only play on one channel at a time.
+    SoundHandle LoadSound(const std::string& soundPath, bool loop = false, SoundLoadPolicy policy = SoundLoadPolicy::Auto);
+    FMOD::Channel* PlaySound(SoundHandle sound, float volume = 1.0f);
+    FMOD::Channel* PlaySound(const std::string& soundPath, float volume = 1.0f);
+    bool IsSoundReady(SoundHandle sound) const;
+    FMOD::Sound* GetSound(SoundHandle sound) const { return m_SoundCache.Get(sound); }
+
+    // File sizes at which Auto switches from PCM to compressed samples, and to streaming
+    void SetSoundPolicyThresholds(size_t compressedFromBytes, size_t streamFromBytes);
+    void SetSoundCacheBudget(size_t budgetBytes);
+    SoundMemoryStats GetSoundMemoryStats() const { return m_SoundCache.GetMemoryStats(); }
+    const AudioCacheStats& GetSoundCacheStats() const { return m_SoundCache.GetStats(); }
+
     bool PlayOneShot(const std::string& eventPath, const FMOD_VECTOR& position = { 0, 0, 0 });
+    bool PlayOneShot(AudioEventId eventId, const FMOD_VECTOR& position = { 0, 0, 0 });
+
+    // One-shot culling (on by default): a 3D one-shot event whose position is further
+    // than its max distance plus the margin from the listener is dropped before an
+    // instance is created. A culled PlayOneShot still returns true.
+    void SetOneShotCulling(bool enabled, float distanceMargin = 0.0f);
+    const OneShotCullStats& GetOneShotCullStats() const { return m_OneShotCullStats; }
+
+    // One-shot coalescing and rate limiting. With coalescing on, requests for the same
+    // event within the radius of each other in one frame play once at their centroid.
+    // Rules add a per-event cooldown, a max-per-second limit and a parameter that gets
+    // the merged count. While coalescing is on, or for events with rules, PlayOneShot
+    // requests play on the next Update; any other event plays immediately.
+    void SetOneShotCoalescing(bool enabled, float radius = 1.0f);
+    void SetOneShotRules(AudioEventId eventId, const OneShotRules& rules);
+    void ClearOneShotRules(AudioEventId eventId);
+    const OneShotCoalescerStats& GetOneShotCoalescerStats() const { return m_OneShotCoalescer.GetStats(); }
 
     // 2D positional audio
     void Set3DListenerPosition(float x, float y);
+    void Set3DListenerPosition(int listener, float x, float y);
+
+    // Multiple listeners (split-screen). Culling and voice scoring use the nearest
+    // listener whose weight is above zero. Both settings survive a Restart.
+    bool SetNumListeners(int numListeners);
+    int GetNumListeners() const { return m_NumListeners; }
+    bool SetListenerWeight(int listener, float weight);
+    const AudioListenerSet& GetActiveListeners() const { return m_ActiveListeners; }
     void Set3DEventPosition(FMOD::Studio::EventInstance* eventInstance, float x, float y);
 
+    // Bulk emitter positions: register an instance once, then move any number of
+    // emitters per frame with UpdateEmitters. Update sends set3DAttributes only for
+    // emitters that moved further than the epsilon. Released instances drop out.
+    EmitterId RegisterEmitter(FMOD::Studio::EventInstance* eventInstance, float x, float y);
+    void UnregisterEmitter(EmitterId id) { m_Emitters.Remove(id); }
+    void UpdateEmitters(std::span<const EmitterUpdate> updates) { m_Emitters.UpdateEmitters(updates); }
+    void SetEmitterEpsilon(float epsilon) { m_Emitters.SetEpsilon(epsilon); }
+    float GetEmitterDistance(EmitterId id) const { return m_Emitters.GetDistance(id); }
+    EmitterStoreStats GetEmitterStats() const { return m_Emitters.GetStats(); }
+
+    // Reverb zones: spheres with a full-wet inner radius and an outer fade radius. Only
+    // the nearest few zones reaching an active listener hold a (pooled) Reverb3D, and
+    // zones are crossfaded in and out over the transition time. Zones survive a Restart.
+    ReverbZoneId AddReverbZone(float x, float y, float minDistance, float maxDistance, const FMOD_REVERB_PROPERTIES& properties);
+    void RemoveReverbZone(ReverbZoneId id) { m_ReverbZones.RemoveZone(id); }
+    bool SetReverbZoneProperties(ReverbZoneId id, const FMOD_REVERB_PROPERTIES& properties) { return m_ReverbZones.SetZoneProperties(id, properties); }
+    void SetMaxActiveReverbZones(int maxActiveZones) { m_ReverbZones.SetMaxActiveZones(maxActiveZones); }
+    void SetReverbTransitionTime(float seconds) { m_ReverbZones.SetTransitionTime(seconds); }
+    ReverbZoneStats GetReverbZoneStats() const { return m_ReverbZones.GetStats(); }
+
     // Parameter control
     bool SetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName, float value);
     float GetEventParameter(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName);
 
+    // Parameter control by cached ID (resolve once, then set without name lookups)
+    bool GetEventParameterId(FMOD::Studio::EventDescription* eventDescription, const std::string& parameterName, FMOD_STUDIO_PARAMETER_ID& parameterId);
+    bool GetEventParameterId(FMOD::Studio::EventInstance* eventInstance, const std::string& parameterName, FMOD_STUDIO_PARAMETER_ID& parameterId);
+    bool SetEventParameterById(FMOD::Studio::EventInstance* eventInstance, FMOD_STUDIO_PARAMETER_ID parameterId, float value);
+    float GetEventParameterById(FMOD::Studio::EventInstance* eventInstance, FMOD_STUDIO_PARAMETER_ID parameterId);
+    bool SetEventParametersByIds(FMOD::Studio::EventInstance* eventInstance, const FMOD_STUDIO_PARAMETER_ID* parameterIds, float* values, int count);
+
     // Global parameter control
     bool SetGlobalParameter(const std::string& parameterName, float value);
     float GetGlobalParameter(const std::string& parameterName);
 
+    // Global parameter control by cached ID
+    bool GetGlobalParameterId(const std::string& parameterName, FMOD_STUDIO_PARAMETER_ID& parameterId);
+    bool SetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value);
+    float GetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId);
+    bool SetGlobalParametersByIds(const FMOD_STUDIO_PARAMETER_ID* parameterIds, float* values, int count);
+
     // Mixing and buses
     FMOD::Studio::Bus* GetBus(const std::string& busPath);
     bool SetBusVolume(const std::string& busPath, float volume);
@@ -62,6 +242,10 @@ public:
     bool SetVCAVolume(const std::string& vcaPath, float volume);
     float GetVCAVolume(const std::string& vcaPath);
 
+    // Bus/VCA handle cache statistics
+    const AudioCacheStats& GetBusCacheStats() const { return m_BusCacheStats; }
+    const AudioCacheStats& GetVCACacheStats() const { return m_VCACacheStats; }
+
     // Runtime snapshot control
     bool StartSnapshot(const std::string& snapshotPath);
     bool StopSnapshot(const std::string& snapshotPath);
@@ -69,6 +253,16 @@ public:
     // Update (call this every frame)
     void Update();
 
+    // Time the last Update spent in the Studio system update
+    float GetLastStudioUpdateMs() const { return m_LastStudioUpdateMs; }
+
+    // Runtime cost telemetry, sampled by Update (every 100 ms by default) into a ring
+    // of the last 600 samples. The readers are lock-free and safe from any thread.
+    void SetTelemetryEnabled(bool enabled, float intervalSeconds = 0.1f) { m_Telemetry.SetEnabled(enabled, intervalSeconds); }
+    AudioTelemetrySummary GetTelemetrySummary(AudioTelemetryMetric metric, size_t windowSamples = 0) const { return m_Telemetry.GetSummary(metric, windowSamples); }
+    size_t CopyTelemetrySamples(std::vector<AudioTelemetrySample>& samples, size_t maxSamples = 0) const { return m_Telemetry.CopySamples(samples, maxSamples); }
+    bool DumpTelemetry(const std::string& path) const { return m_Telemetry.DumpToFile(path); }
+
     // Direct access to FMOD systems (use carefully)
     FMOD::Studio::System* GetStudioSystem() const { return m_StudioSystem; }
     FMOD::System* GetCoreSystem() const { return m_CoreSystem; }
@@ -79,22 +273,144 @@ private:
 
     FMOD_RESULT ErrorCheck(FMOD_RESULT result) const;
 
+    // Issues the FMOD bank load for the given mode
+    FMOD_RESULT LoadBankData(const std::string& bankName, const std::string& bankPath, BankLoadMode mode, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank);
+    void ReleaseBankMemory(const std::string& bankName);
+
+    // Advances pending non-blocking bank loads
+    void PollBankLoads();
+
+    // Bus/VCA handle cache maintenance
+    void CacheBankHandles(FMOD::Studio::Bank* bank);
+    void InvalidateHandleCaches();
+
     // FMOD systems
     FMOD::Studio::System* m_StudioSystem = nullptr;
     FMOD::System* m_CoreSystem = nullptr;
 
+    // Settings Initialize was called with, reused by Restart
+    int m_MaxChannels = 32;
+    int m_StudioFlags = FMOD_STUDIO_INIT_NORMAL;
+    int m_CoreFlags = FMOD_INIT_NORMAL;
+
+    // Adaptive DSP buffer sizing
+    LatencyProfileManager m_LatencyProfiles;
+    bool m_AdaptiveLatency = false;
+    bool m_RestartPending = false;
+    std::function<void()> m_RestartCallback;
+
+    // Custom allocator settings
+    bool m_UseCustomAllocator = false;
+    size_t m_AllocatorArenaBytes = 4 * 1024 * 1024;
+
+    // Custom file system (null when FMOD's default file I/O is used)
+    std::unique_ptr<AsyncFileSystem> m_FileSystem;
+    bool m_UseAsyncFileSystem = false;
+    int m_FileSystemThreads = 2;
+
     // Banks
     std::map<std::string, FMOD::Studio::Bank*> m_Banks;
 
+    // Where each loaded bank came from, so Restart can reload it
+    struct BankSource
+    {
+        std::string path;
+        BankLoadMode mode = BankLoadMode::File;
+    };
+    std::map<std::string, BankSource> m_BankSources;
+
+    // File mappings backing memory-mapped banks; must outlive the bank
+    std::map<std::string, std::unique_ptr<MappedFile>> m_MappedBanks;
+
+    // Banks issued with LoadBankAsync that haven't finished loading yet
+    struct PendingBankLoad
+    {
+        std::shared_ptr<BankLoadStatus> status;
+        FMOD::Studio::Bank* bank = nullptr;
+        BankSource source;
+        std::chrono::steady_clock::time_point startTime;
+    };
+    std::vector<PendingBankLoad> m_PendingBankLoads;
+
+    // Per-event sample data residency (only used in on-demand mode)
+    SampleResidencyManager m_SampleResidency;
+    bool m_SampleDataOnDemand = false;
+
     // Cached sounds
-    std::map<std::string, FMOD::Sound*> m_Sounds;
+    SoundCache m_SoundCache;
+
+    // Recycled PlayOneShot instances
+    EventInstancePool m_InstancePools;
+    bool IsInstancePoolingEnabled() const { return m_InstancePools.GetPoolSize() > 0; }
+
+    // Cached event descriptions, keyed by event path hash
+    HashedHandleTable<FMOD::Studio::EventDescription*> m_EventDescriptions;
+
+    // Cached spatial metadata for one-shot culling, keyed by event path hash
+    struct EventMetadata
+    {
+        FMOD::Studio::EventDescription* description = nullptr;
+        float minDistance = 0.0f;
+        float maxDistance = 0.0f;
+        bool is3D = false;
+        bool isOneshot = false;
+    };
+    HashedHandleTable<EventMetadata> m_EventMetadata;
+    const EventMetadata* GetEventMetadata(AudioEventId eventId);
+
+    // Listener state as last set through Set3DListenerPosition / SetListenerWeight
+    struct ListenerState
+    {
+        FMOD_VECTOR position = { 0.0f, 0.0f, 0.0f };
+        float weight = 1.0f;
+    };
+    ListenerState m_Listeners[FMOD_MAX_LISTENERS];
+    int m_NumListeners = 1;
+    AudioListenerSet m_ActiveListeners;
+    void RebuildActiveListeners();
+
+    bool m_CullOneShots = true;
+    float m_OneShotCullMargin = 0.0f;
+    OneShotCullStats m_OneShotCullStats;
 
-    // Cached event descriptions
-    std::map<std::string, FMOD::Studio::EventDescription*> m_EventDescriptions;
+    // Emitters moved through UpdateEmitters
+    EmitterStore m_Emitters;
+
+    // Reverb zones and their pooled Reverb3D objects
+    ReverbZoneManager m_ReverbZones;
+
+    // This frame's batched one-shots
+    OneShotCoalescer m_OneShotCoalescer;
+
+    FMOD::Studio::EventInstance* CreateInstance(FMOD::Studio::EventDescription* eventDescription);
+    bool StartOneShot(FMOD::Studio::EventDescription* eventDescription, const FMOD_VECTOR& position, const OneShotRules* rules, int count);
+    void FlushOneShots();
+
+    // Cached parameter IDs, keyed by (event description, parameter name) hash. The key
+    // is only a hash, so each entry keeps what it was resolved for and lookups compare it.
+    struct CachedParameterId
+    {
+        FMOD::Studio::EventDescription* description = nullptr; // Null for global parameters
+        std::string name;
+        FMOD_STUDIO_PARAMETER_ID id = {};
+    };
+    HashedHandleTable<CachedParameterId> m_EventParameterIds;
+
+    // Cached global parameter IDs, keyed by parameter name hash
+    HashedHandleTable<CachedParameterId> m_GlobalParameterIds;
+
+    // Cached bus and VCA handles, keyed by path hash
+    HashedHandleTable<FMOD::Studio::Bus*> m_Buses;
+    HashedHandleTable<FMOD::Studio::VCA*> m_VCAs;
+    AudioCacheStats m_BusCacheStats;
+    AudioCacheStats m_VCACacheStats;
 
     // Active snapshots
     std::map<std::string, FMOD::Studio::EventInstance*> m_ActiveSnapshots;
 
+    float m_LastStudioUpdateMs = 0.0f;
+    AudioTelemetry m_Telemetry;
+
     // Initialization state
     bool m_Initialized = false;
 };
@@ -2,6 +2,8 @@
 #include "GameAudioManager.h"
 #include <filesystem>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
 
 GameAudioManager& GameAudioManager::GetInstance()
 {
@@ -11,107 +13,482 @@ GameAudioManager& GameAudioManager::GetInstance()
 
 bool GameAudioManager::Initialize()
 {
-    return FMODAudioSystem::GetInstance().Initialize();
+    // Enough records that a typical scene never grows the slot map
+    m_Events.Reserve(256);
+
+    FMODAudioSystem& audioSystem = FMODAudioSystem::GetInstance();
+    audioSystem.SetRestartCallback([this]() { OnAudioSystemRestart(); });
+    return audioSystem.Initialize();
 }
 
 void GameAudioManager::Shutdown()
 {
+    // Hand FMOD back to this thread
+    StopAudioThread();
+
     // Stop and clear all active events
-    m_ActiveEvents.clear();
+    m_Occlusion.Stop();
+    m_Occlusion.Clear();
+    m_VirtualVoices.Clear();
     m_CurrentMusicTrack = nullptr;
+    m_DroppedEvents.clear();
 
     // Shutdown FMOD
     FMODAudioSystem::GetInstance().Shutdown();
+
+    // The instances went with the studio system; outstanding handles go stale
+    ClearEventRecords();
+}
+
+void GameAudioManager::ClearEventRecords()
+{
+    // Destroyed notices for instances that no longer exist are moot
+    EventLifetimeNotice notice;
+    while (m_LifetimeNotices.Pop(notice))
+    {
+    }
+    m_LifetimeNoticesDropped = false;
+    m_Events.Clear();
+}
+
+void GameAudioManager::ApplyPendingRestart()
+{
+    FMODAudioSystem& audioSystem = FMODAudioSystem::GetInstance();
+    if (!audioSystem.IsRestartPending())
+    {
+        return;
+    }
+
+    // Park looping emitters while their timeline positions can still be read
+    m_VirtualVoices.DemoteAll();
+    audioSystem.ApplyPendingRestart();
+}
+
+void GameAudioManager::OnAudioSystemRestart()
+{
+    // Runs inside FMODAudioSystem::Restart, with the audio lock already held by the caller.
+    // Every instance went with the old system; looping emitters are promoted again by
+    // the next Update, everything else is dropped and its handles go stale. Records go
+    // first so wrappers released below don't touch the dead instances.
+    ClearEventRecords();
+    m_Occlusion.Clear();
+    DropMusicTrack();
+
+    std::cout << "Audio system restarted, events created before the restart are invalid." << std::endl;
+}
+
+bool GameAudioManager::LoadBanks(const std::string& banksFolder, BankLoadMode mode)
+{
+    std::error_code error;
+    if (!std::filesystem::is_directory(banksFolder, error))
+    {
+        std::cerr << "Error loading banks: '" << banksFolder << "' is not a directory" << std::endl;
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // Issue all banks in parallel, then block until they're resident
+    std::vector<BankLoadHandle> handles = LoadBanksAsync(banksFolder, mode);
+    // A bank stuck loading is reported as a failure instead of hanging boot. Handles
+    // that timed out are still updated by the audio thread, so read them under the lock.
+    bool timedOut = false;
+    {
+        auto lock = LockAudio();
+        FMODAudioSystem::GetInstance().WaitForBankLoads();
+
+        for (const auto& handle : handles)
+        {
+            if (!handle->IsDone())
+            {
+                std::cerr << "Timed out loading bank: " << handle->bankName << std::endl;
+                timedOut = true;
+            }
+            else if (handle->state != BankLoadState::Loaded)
+            {
+                std::cerr << "Failed to load bank: " << handle->bankName << std::endl;
+            }
+        }
+    }
+
+    std::chrono::duration<float, std::milli> loadTime = std::chrono::steady_clock::now() - startTime;
+    std::cout << "Loaded " << handles.size() << " banks in " << loadTime.count() << " ms" << std::endl;
+    return !timedOut;
 }
 
-bool GameAudioManager::LoadBanks(const std::string& banksFolder)
+std::vector<BankLoadHandle> GameAudioManager::LoadBanksAsync(const std::string& banksFolder, BankLoadMode mode)
 {
+    std::vector<BankLoadHandle> handles;
+
     try
     {
+        std::vector<std::filesystem::path> bankFiles;
         for (const auto& entry : std::filesystem::directory_iterator(banksFolder))
         {
-            if (entry.is_regular_file())
+            // Only load .bank files
+            if (entry.is_regular_file() && entry.path().extension().string() == ".bank")
             {
-                std::string filename = entry.path().filename().string();
-                std::string extension = entry.path().extension().string();
-
-                // Only load .bank files
-                if (extension == ".bank")
-                {
-                    std::string bankName = entry.path().stem().string();
-                    std::string bankPath = entry.path().string();
-
-                    if (!LoadBank(bankName, bankPath))
-                    {
-                        std::cerr << "Failed to load bank: " << bankName << std::endl;
-                    }
-                }
+                bankFiles.push_back(entry.path());
             }
         }
-        return true;
+
+        // Master and Master.strings go first so the mixer and path lookups are available early
+        auto loadOrder = [](const std::filesystem::path& path) {
+            std::string bankName = path.stem().string();
+            if (bankName == "Master") return 0;
+            if (bankName == "Master.strings") return 1;
+            return 2;
+        };
+        std::stable_sort(bankFiles.begin(), bankFiles.end(),
+            [&](const std::filesystem::path& a, const std::filesystem::path& b) {
+                return loadOrder(a) < loadOrder(b);
+            });
+
+        auto lock = LockAudio();
+        for (const auto& bankFile : bankFiles)
+        {
+            std::string bankName = bankFile.stem().string();
+            std::string bankPath = bankFile.string();
+            handles.push_back(FMODAudioSystem::GetInstance().LoadBankAsync(bankName, bankPath, mode));
+        }
     }
     catch (const std::exception& e)
     {
         std::cerr << "Error loading banks: " << e.what() << std::endl;
-        return false;
     }
+
+    return handles;
 }
 
-bool GameAudioManager::LoadBank(const std::string& bankName, const std::string& bankPath)
+bool GameAudioManager::LoadBank(const std::string& bankName, const std::string& bankPath, BankLoadMode mode)
 {
-    return FMODAudioSystem::GetInstance().LoadBank(bankName, bankPath);
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().LoadBank(bankName, bankPath, mode);
 }
 
 std::shared_ptr<AudioEvent> GameAudioManager::CreateEvent(const std::string& eventPath)
 {
-    auto event = std::make_shared<AudioEvent>(eventPath);
-    if (event->IsValid())
+    auto lock = LockAudio();
+    AudioEventHandle handle = CreateEventRecord(AudioEventId(eventPath));
+    if (handle == kInvalidAudioEventHandle)
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<AudioEvent>(handle);
+}
+
+AudioEventHandle GameAudioManager::CreateEventHandle(AudioEventId eventId)
+{
+    auto lock = LockAudio();
+    return CreateEventRecord(eventId);
+}
+
+AudioEventHandle GameAudioManager::CreateEventRecord(AudioEventId eventId)
+{
+    FMOD::Studio::EventInstance* instance = FMODAudioSystem::GetInstance().CreateEventInstance(eventId);
+    if (instance == nullptr)
+    {
+        return kInvalidAudioEventHandle;
+    }
+
+    AudioEventHandle handle = m_Events.Insert(instance, eventId, kAudioEventOwned);
+
+    // The slot index rides in the user data so the callback needs no lookup
+    instance->setUserData(reinterpret_cast<void*>(static_cast<uintptr_t>(AudioEventSlotMap::IndexOf(handle))));
+    instance->setCallback(OnEventLifetime, FMOD_STUDIO_EVENT_CALLBACK_STOPPED | FMOD_STUDIO_EVENT_CALLBACK_DESTROYED);
+    return handle;
+}
+
+FMOD_RESULT F_CALL GameAudioManager::OnEventLifetime(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE* event, void*)
+{
+    FMOD::Studio::EventInstance* instance = reinterpret_cast<FMOD::Studio::EventInstance*>(event);
+
+    EventLifetimeNotice notice;
+    notice.instance = instance;
+    notice.type = type;
+
+    void* userData = nullptr;
+    instance->getUserData(&userData);
+    notice.slot = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(userData));
+
+    GameAudioManager& manager = GetInstance();
+    if (!manager.m_LifetimeNotices.Push(notice))
+    {
+        manager.m_LifetimeNoticesDropped = true;
+    }
+
+    return FMOD_OK;
+}
+
+void GameAudioManager::ReleaseEventHandle(AudioEventHandle handle)
+{
+    auto lock = LockAudio();
+    ReleaseEventRecord(handle);
+}
+
+void GameAudioManager::ReleaseEventRecord(AudioEventHandle handle)
+{
+    AudioEventRecord* record = m_Events.Get(handle);
+    if (record == nullptr || !(record->flags & kAudioEventOwned))
     {
-        m_ActiveEvents.push_back(event);
-        return event;
+        return;
     }
 
-    return nullptr;
+    // FMOD destroys the instance once it stops; the record lives until the destroyed
+    // callback so the handle stays usable while the event plays out
+    record->flags &= ~kAudioEventOwned;
+    record->instance->release();
+}
+
+FMOD::Studio::EventInstance* GameAudioManager::GetEventInstance(AudioEventHandle handle) const
+{
+    const AudioEventRecord* record = m_Events.Get(handle);
+    return (record != nullptr) ? record->instance : nullptr;
 }
 
 bool GameAudioManager::PlayOneShot(const std::string& eventPath, float x, float y)
 {
+    return PlayOneShot(AudioEventId(eventPath), x, y);
+}
+
+bool GameAudioManager::PlayOneShot(AudioEventId eventId, float x, float y)
+{
+    if (m_AudioThread.IsRunning())
+    {
+        return m_AudioThread.PostPlayOneShot(eventId, x, y);
+    }
+
     FMOD_VECTOR position = { x, y, 0 };
-    return FMODAudioSystem::GetInstance().PlayOneShot(eventPath, position);
+    return FMODAudioSystem::GetInstance().PlayOneShot(eventId, position);
 }
 
 void GameAudioManager::SetListenerPosition(float x, float y)
 {
-    FMODAudioSystem::GetInstance().Set3DListenerPosition(x, y);
+    SetListenerPosition(0, x, y);
+}
+
+void GameAudioManager::SetListenerPosition(int listener, float x, float y)
+{
+    if (m_AudioThread.IsRunning())
+    {
+        m_AudioThread.PostSetListenerPosition(listener, x, y);
+        return;
+    }
+
+    FMODAudioSystem::GetInstance().Set3DListenerPosition(listener, x, y);
+}
+
+bool GameAudioManager::SetNumListeners(int numListeners)
+{
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().SetNumListeners(numListeners);
+}
+
+bool GameAudioManager::SetListenerWeight(int listener, float weight)
+{
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().SetListenerWeight(listener, weight);
+}
+
+EmitterId GameAudioManager::RegisterEmitter(const std::shared_ptr<AudioEvent>& event, float x, float y)
+{
+    if (!event || !event->IsValid())
+    {
+        return kInvalidEmitterId;
+    }
+
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().RegisterEmitter(event->GetRawEventInstance(), x, y);
+}
+
+void GameAudioManager::UnregisterEmitter(EmitterId id)
+{
+    auto lock = LockAudio();
+    FMODAudioSystem::GetInstance().UnregisterEmitter(id);
+}
+
+void GameAudioManager::UpdateEmitters(std::span<const EmitterUpdate> updates)
+{
+    auto lock = LockAudio();
+    FMODAudioSystem::GetInstance().UpdateEmitters(updates);
+}
+
+VirtualVoiceId GameAudioManager::AddLoopingEmitter(const std::string& eventPath, float x, float y, float priority, float loudness)
+{
+    auto lock = LockAudio();
+    return m_VirtualVoices.Add(eventPath, x, y, priority, loudness);
+}
+
+void GameAudioManager::RemoveLoopingEmitter(VirtualVoiceId id)
+{
+    auto lock = LockAudio();
+    m_VirtualVoices.Remove(id);
+}
+
+void GameAudioManager::SetLoopingEmitterPosition(VirtualVoiceId id, float x, float y)
+{
+    auto lock = LockAudio();
+    m_VirtualVoices.SetPosition(id, x, y);
+}
+
+void GameAudioManager::SetLoopingEmitterLoopRegion(VirtualVoiceId id, int startMs, int endMs)
+{
+    auto lock = LockAudio();
+    m_VirtualVoices.SetLoopRegion(id, startMs, endMs);
+}
+
+void GameAudioManager::SetMaxRealVoices(int maxRealVoices)
+{
+    auto lock = LockAudio();
+    m_VirtualVoices.SetMaxRealVoices(maxRealVoices);
+}
+
+void GameAudioManager::GetLoopingEmittersInRadius(float x, float y, float radius, std::vector<VirtualVoiceId>& results)
+{
+    auto lock = LockAudio();
+    m_VirtualVoices.QueryRadius(x, y, radius, results);
+}
+
+VirtualVoiceStats GameAudioManager::GetVirtualVoiceStats()
+{
+    auto lock = LockAudio();
+    return m_VirtualVoices.GetStats();
+}
+
+ReverbZoneId GameAudioManager::AddReverbZone(float x, float y, float minDistance, float maxDistance, const FMOD_REVERB_PROPERTIES& properties)
+{
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().AddReverbZone(x, y, minDistance, maxDistance, properties);
+}
+
+void GameAudioManager::RemoveReverbZone(ReverbZoneId id)
+{
+    auto lock = LockAudio();
+    FMODAudioSystem::GetInstance().RemoveReverbZone(id);
+}
+
+bool GameAudioManager::SetReverbZoneProperties(ReverbZoneId id, const FMOD_REVERB_PROPERTIES& properties)
+{
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().SetReverbZoneProperties(id, properties);
+}
+
+void GameAudioManager::SetMaxActiveReverbZones(int maxActiveZones)
+{
+    auto lock = LockAudio();
+    FMODAudioSystem::GetInstance().SetMaxActiveReverbZones(maxActiveZones);
+}
+
+void GameAudioManager::SetReverbTransitionTime(float seconds)
+{
+    auto lock = LockAudio();
+    FMODAudioSystem::GetInstance().SetReverbTransitionTime(seconds);
+}
+
+ReverbZoneStats GameAudioManager::GetReverbZoneStats()
+{
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().GetReverbZoneStats();
+}
+
+bool GameAudioManager::StartOcclusion(int workerThreads)
+{
+    auto lock = LockAudio();
+    return m_Occlusion.Start(workerThreads);
+}
+
+void GameAudioManager::StopOcclusion()
+{
+    auto lock = LockAudio();
+    m_Occlusion.Stop();
+}
+
+void GameAudioManager::SetOcclusionWalls(std::vector<OcclusionWall> walls)
+{
+    // Build the BVH before taking the lock
+    auto geometry = std::make_shared<const OcclusionGeometry>(std::move(walls));
+    auto lock = LockAudio();
+    m_Occlusion.SetGeometry(std::move(geometry));
+}
+
+void GameAudioManager::SetOcclusionBudget(int queriesPerUpdate)
+{
+    auto lock = LockAudio();
+    m_Occlusion.SetBudget(queriesPerUpdate);
+}
+
+OcclusionSourceId GameAudioManager::TrackOcclusion(const std::shared_ptr<AudioEvent>& event, const std::string& parameterName)
+{
+    auto lock = LockAudio();
+    return m_Occlusion.Track(event, parameterName);
+}
+
+void GameAudioManager::UntrackOcclusion(OcclusionSourceId id)
+{
+    auto lock = LockAudio();
+    m_Occlusion.Untrack(id);
+}
+
+OcclusionStats GameAudioManager::GetOcclusionStats()
+{
+    auto lock = LockAudio();
+    return m_Occlusion.GetStats();
 }
 
 bool GameAudioManager::SetGlobalParameter(const std::string& name, float value)
 {
+    if (m_AudioThread.IsRunning())
+    {
+        return m_AudioThread.PostSetGlobalParameter(name, value);
+    }
+
     return FMODAudioSystem::GetInstance().SetGlobalParameter(name, value);
 }
 
 float GameAudioManager::GetGlobalParameter(const std::string& name)
 {
+    auto lock = LockAudio();
     return FMODAudioSystem::GetInstance().GetGlobalParameter(name);
 }
 
+bool GameAudioManager::GetGlobalParameterId(const std::string& name, FMOD_STUDIO_PARAMETER_ID& parameterId)
+{
+    auto lock = LockAudio();
+    return FMODAudioSystem::GetInstance().GetGlobalParameterId(name, parameterId);
+}
+
+bool GameAudioManager::SetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value)
+{
+    if (m_AudioThread.IsRunning())
+    {
+        return m_AudioThread.PostSetGlobalParameterById(parameterId, value);
+    }
+
+    return FMODAudioSystem::GetInstance().SetGlobalParameterById(parameterId, value);
+}
+
 bool GameAudioManager::SetBusVolume(const std::string& busPath, float volume)
 {
+    auto lock = LockAudio();
     return FMODAudioSystem::GetInstance().SetBusVolume(busPath, volume);
 }
 
 bool GameAudioManager::SetVCAVolume(const std::string& vcaPath, float volume)
 {
+    auto lock = LockAudio();
     return FMODAudioSystem::GetInstance().SetVCAVolume(vcaPath, volume);
 }
 
 bool GameAudioManager::StartSnapshot(const std::string& snapshotPath)
 {
+    auto lock = LockAudio();
     return FMODAudioSystem::GetInstance().StartSnapshot(snapshotPath);
 }
 
 bool GameAudioManager::StopSnapshot(const std::string& snapshotPath)
 {
+    auto lock = LockAudio();
     return FMODAudioSystem::GetInstance().StopSnapshot(snapshotPath);
 }
 
@@ -144,38 +521,194 @@ bool GameAudioManager::StopAllMusic(bool allowFadeOut)
 
 void GameAudioManager::Update(float deltaTime)
 {
-    // Accumulate delta time
-    m_TimeSinceLastUpdate += deltaTime;
+    // The audio thread ticks FMOD itself; only our own bookkeeping is left
+    if (m_AudioThread.IsRunning())
+    {
+        std::vector<std::shared_ptr<AudioEvent>> dropped;
+        {
+            auto lock = LockAudio();
+            ApplyPendingRestart();
+            UpdateVirtualVoices();
+            UpdateOcclusion();
+            CleanupEvents();
+            dropped.swap(m_DroppedEvents);
+        }
+        // Destroyed here, after the lock, since their destructors take it
+        return;
+    }
 
-    // Update FMOD at fixed intervals (e.g., 60Hz)
-    const float updateInterval = 1.0f / 60.0f;
-    if (m_TimeSinceLastUpdate >= updateInterval)
+    // A restart requested by the last tick runs here, outside FMODAudioSystem::Update
+    ApplyPendingRestart();
+
+    // Update FMOD at a fixed rate; leftover time carries over to the next frame
+    int ticks = m_TickScheduler.Advance(deltaTime);
+    if (ticks == 0)
     {
-        // Update FMOD
-        FMODAudioSystem::GetInstance().Update();
+        return;
+    }
 
-        // Clean up finished events
-        CleanupEvents();
+    // Pick which looping emitters are real before FMOD sends this frame's commands
+    UpdateVirtualVoices();
+    UpdateOcclusion();
 
-        // Reset timer
-        m_TimeSinceLastUpdate = 0.0f;
+    for (int i = 0; i < ticks; ++i)
+    {
+        RunAudioTick(i > 0);
     }
+
+    // Clean up finished events
+    CleanupEvents();
+    m_DroppedEvents.clear();
+}
+
+void GameAudioManager::RunAudioTick(bool catchUp)
+{
+    FMODAudioSystem& audioSystem = FMODAudioSystem::GetInstance();
+    auto tickStart = std::chrono::steady_clock::now();
+    audioSystem.Update();
+    m_TickScheduler.RecordTick(tickStart, audioSystem.GetLastStudioUpdateMs(), catchUp);
+}
+
+void GameAudioManager::SetAudioTickRate(float ticksPerSecond)
+{
+    auto lock = LockAudio();
+    m_TickScheduler.SetTickRate(ticksPerSecond);
+}
+
+void GameAudioManager::SetMaxAudioCatchUpTicks(int maxTicks)
+{
+    auto lock = LockAudio();
+    m_TickScheduler.SetMaxCatchUpTicks(maxTicks);
+}
+
+AudioTickStats GameAudioManager::GetAudioTickStats()
+{
+    auto lock = LockAudio();
+    return m_TickScheduler.GetStats();
+}
+
+void GameAudioManager::ResetAudioTickStats()
+{
+    auto lock = LockAudio();
+    m_TickScheduler.ResetStats();
+}
+
+void GameAudioManager::SetTelemetryEnabled(bool enabled, float intervalSeconds)
+{
+    auto lock = LockAudio();
+    FMODAudioSystem::GetInstance().SetTelemetryEnabled(enabled, intervalSeconds);
+}
+
+AudioTelemetrySummary GameAudioManager::GetTelemetrySummary(AudioTelemetryMetric metric, size_t windowSamples) const
+{
+    return FMODAudioSystem::GetInstance().GetTelemetrySummary(metric, windowSamples);
+}
+
+bool GameAudioManager::DumpTelemetry(const std::string& path) const
+{
+    return FMODAudioSystem::GetInstance().DumpTelemetry(path);
+}
+
+bool GameAudioManager::StartAudioThread(float updateRateHz)
+{
+    if (updateRateHz > 0.0f && !m_AudioThread.IsRunning())
+    {
+        m_TickScheduler.SetTickRate(updateRateHz);
+    }
+
+    if (!m_AudioThread.Start(&m_TickScheduler))
+    {
+        std::cerr << "Failed to start audio thread!" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void GameAudioManager::StopAudioThread()
+{
+    m_AudioThread.Stop();
+}
+
+std::unique_lock<std::mutex> GameAudioManager::LockAudio()
+{
+    if (m_AudioThread.IsRunning())
+    {
+        return m_AudioThread.LockFmod();
+    }
+
+    return std::unique_lock<std::mutex>();
+}
+
+void GameAudioManager::UpdateVirtualVoices()
+{
+    m_VirtualVoices.Update(FMODAudioSystem::GetInstance().GetActiveListeners());
+}
+
+void GameAudioManager::UpdateOcclusion()
+{
+    m_Occlusion.Update(FMODAudioSystem::GetInstance().GetActiveListeners());
 }
 
 void GameAudioManager::CleanupEvents()
 {
-    // Remove any events that are no longer active or valid
-    m_ActiveEvents.erase(
-        std::remove_if(m_ActiveEvents.begin(), m_ActiveEvents.end(),
-            [](const std::shared_ptr<AudioEvent>& event) {
-                return !event->IsValid() || !event->IsPlaying();
-            }),
-        m_ActiveEvents.end()
-    );
+    // Cost follows the number of events that ended, not the number alive
+    EventLifetimeNotice notice;
+    while (m_LifetimeNotices.Pop(notice))
+    {
+        AudioEventHandle handle = m_Events.HandleAt(notice.slot);
+        AudioEventRecord* record = m_Events.Get(handle);
+        if (record == nullptr || record->instance != notice.instance)
+        {
+            continue;
+        }
+
+        if (m_CurrentMusicTrack && m_CurrentMusicTrack->GetRawEventInstance() == notice.instance)
+        {
+            DropMusicTrack();
+        }
+
+        if (notice.type == FMOD_STUDIO_EVENT_CALLBACK_DESTROYED)
+        {
+            m_Events.Erase(handle);
+        }
+    }
+
+    if (m_LifetimeNoticesDropped.exchange(false))
+    {
+        ScanForDestroyedEvents();
+    }
+}
+
+void GameAudioManager::ScanForDestroyedEvents()
+{
+    for (uint32_t slot = 0; slot < m_Events.Capacity(); ++slot)
+    {
+        AudioEventHandle handle = m_Events.HandleAt(slot);
+        AudioEventRecord* record = m_Events.Get(handle);
+        if (record != nullptr && !record->instance->isValid())
+        {
+            m_Events.Erase(handle);
+        }
+    }
+
+    // Already under the audio lock, so ask FMOD directly rather than through AudioEvent
+    if (m_CurrentMusicTrack)
+    {
+        FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STOPPED;
+        FMOD_RESULT result = m_CurrentMusicTrack->GetRawEventInstance()->getPlaybackState(&state);
+        if (result != FMOD_OK || state != FMOD_STUDIO_PLAYBACK_PLAYING)
+        {
+            DropMusicTrack();
+        }
+    }
+}
 
-    // Check if music track is still playing
-    if (m_CurrentMusicTrack && (!m_CurrentMusicTrack->IsValid() || !m_CurrentMusicTrack->IsPlaying()))
+void GameAudioManager::DropMusicTrack()
+{
+    if (m_CurrentMusicTrack)
     {
+        m_DroppedEvents.push_back(std::move(m_CurrentMusicTrack));
         m_CurrentMusicTrack = nullptr;
     }
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 
 #include "FMODAudioSystem.h"
 #include "AudioEvent.h"
+#include "AudioThread.h"
+#include "AudioTickScheduler.h"
+#include "MpscRing.h"
+#include "OcclusionSystem.h"
+#include "VirtualVoiceManager.h"
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -24,19 +29,75 @@ public:
     void Shutdown();
 
     // Bank loading
-    bool LoadBanks(const std::string& banksFolder);
-    bool LoadBank(const std::string& bankName, const std::string& bankPath);
+    // Blocks until every bank has loaded; returns false if one is still loading after the timeout
+    bool LoadBanks(const std::string& banksFolder, BankLoadMode mode = BankLoadMode::File);
+    bool LoadBank(const std::string& bankName, const std::string& bankPath, BankLoadMode mode = BankLoadMode::File);
+
+    // Issues every bank in the folder at once without blocking (Master banks first).
+    // Loads complete during Update().
+    std::vector<BankLoadHandle> LoadBanksAsync(const std::string& banksFolder, BankLoadMode mode = BankLoadMode::File);
 
     // Event playback
     std::shared_ptr<AudioEvent> CreateEvent(const std::string& eventPath);
+
+    // Handle-based events: creation and release reuse slot-map records with no
+    // allocation, and a stale handle is caught by its generation. Release a handle
+    // when done with it; an event still playing plays out first. Both take the
+    // audio lock, so don't call them while already holding it.
+    AudioEventHandle CreateEventHandle(AudioEventId eventId);
+    void ReleaseEventHandle(AudioEventHandle handle);
+    bool IsEventHandleValid(AudioEventHandle handle) const { return m_Events.Get(handle) != nullptr; }
+    FMOD::Studio::EventInstance* GetEventInstance(AudioEventHandle handle) const;
     bool PlayOneShot(const std::string& eventPath, float x = 0.0f, float y = 0.0f);
+    bool PlayOneShot(AudioEventId eventId, float x = 0.0f, float y = 0.0f);
 
     // Listener position (for game's camera or player)
     void SetListenerPosition(float x, float y);
 
+    // Split-screen: one listener per player, culled against the nearest one
+    bool SetNumListeners(int numListeners);
+    bool SetListenerWeight(int listener, float weight);
+    void SetListenerPosition(int listener, float x, float y);
+
+    // Bulk emitter positions for many moving events (see FMODAudioSystem::UpdateEmitters)
+    EmitterId RegisterEmitter(const std::shared_ptr<AudioEvent>& event, float x, float y);
+    void UnregisterEmitter(EmitterId id);
+    void UpdateEmitters(std::span<const EmitterUpdate> updates);
+
+    // Looping world emitters beyond the voice budget. Only the maxRealVoices highest
+    // scoring emitters (priority x loudness x distance rolloff) own an event instance;
+    // the rest are virtual and resume at the right timeline position when promoted.
+    VirtualVoiceId AddLoopingEmitter(const std::string& eventPath, float x, float y, float priority = 1.0f, float loudness = 1.0f);
+    void RemoveLoopingEmitter(VirtualVoiceId id);
+    void SetLoopingEmitterPosition(VirtualVoiceId id, float x, float y);
+    void SetLoopingEmitterLoopRegion(VirtualVoiceId id, int startMs, int endMs);
+    void SetMaxRealVoices(int maxRealVoices);
+    void GetLoopingEmittersInRadius(float x, float y, float radius, std::vector<VirtualVoiceId>& results);
+    VirtualVoiceStats GetVirtualVoiceStats();
+
+    // Wall occlusion. Tracked events get their occlusion parameter driven from
+    // listener-to-emitter traces against the walls, a budgeted number per update.
+    bool StartOcclusion(int workerThreads = 2);
+    void StopOcclusion();
+    void SetOcclusionWalls(std::vector<OcclusionWall> walls);
+    void SetOcclusionBudget(int queriesPerUpdate);
+    OcclusionSourceId TrackOcclusion(const std::shared_ptr<AudioEvent>& event, const std::string& parameterName = "Occlusion");
+    void UntrackOcclusion(OcclusionSourceId id);
+    OcclusionStats GetOcclusionStats();
+
+    // Per-room reverb (see FMODAudioSystem::AddReverbZone)
+    ReverbZoneId AddReverbZone(float x, float y, float minDistance, float maxDistance, const FMOD_REVERB_PROPERTIES& properties);
+    void RemoveReverbZone(ReverbZoneId id);
+    bool SetReverbZoneProperties(ReverbZoneId id, const FMOD_REVERB_PROPERTIES& properties);
+    void SetMaxActiveReverbZones(int maxActiveZones);
+    void SetReverbTransitionTime(float seconds);
+    ReverbZoneStats GetReverbZoneStats();
+
     // Global parameters (like game state, environment, etc.)
     bool SetGlobalParameter(const std::string& name, float value);
     float GetGlobalParameter(const std::string& name);
+    bool GetGlobalParameterId(const std::string& name, FMOD_STUDIO_PARAMETER_ID& parameterId);
+    bool SetGlobalParameterById(FMOD_STUDIO_PARAMETER_ID parameterId, float value);
 
     // Mixing control
     bool SetBusVolume(const std::string& busPath, float volume);
@@ -50,20 +111,87 @@ public:
     std::shared_ptr<AudioEvent> PlayMusicTrack(const std::string& musicEventPath);
     bool StopAllMusic(bool allowFadeOut = true);
 
-    // Update function to be called every frame
+    // Update function to be called every frame. A restart requested by adaptive
+    // latency is applied here first: looping emitters are re-promoted, but every other
+    // event (AudioEvent wrappers, handles, the music track, occlusion tracking, bulk
+    // emitters) is gone and reports invalid, so recreate whatever should keep playing.
     void Update(float deltaTime);
 
+    // Fixed-step FMOD ticks: Update (or the audio thread) runs as many ticks as the
+    // elapsed time covers, carrying the remainder over, and at most maxCatchUpTicks
+    // per frame after a stall. Stats hold Studio update time and tick jitter histograms.
+    void SetAudioTickRate(float ticksPerSecond);
+    void SetMaxAudioCatchUpTicks(int maxTicks);
+    AudioTickStats GetAudioTickStats();
+    void ResetAudioTickStats();
+
+    // Engine cost telemetry (see FMODAudioSystem::SetTelemetryEnabled); the readers
+    // don't take the audio lock
+    void SetTelemetryEnabled(bool enabled, float intervalSeconds = 0.1f);
+    AudioTelemetrySummary GetTelemetrySummary(AudioTelemetryMetric metric, size_t windowSamples = 0) const;
+    bool DumpTelemetry(const std::string& path) const;
+
+    // Audio-thread mode: FMOD is ticked on a dedicated thread. PlayOneShot, listener
+    // and parameter setters and AudioEvent playback control are then posted to it and
+    // may be called from any thread; everything else must still be called from the
+    // game thread. A rate of 0 keeps the configured audio tick rate.
+    bool StartAudioThread(float updateRateHz = 0.0f);
+    void StopAudioThread();
+    AudioThread& GetAudioThread() { return m_AudioThread; }
+
+    // Holds the FMOD lock while the audio thread runs (an empty lock otherwise)
+    std::unique_lock<std::mutex> LockAudio();
+
 private:
     GameAudioManager() = default;
     ~GameAudioManager() = default;
 
-    // Keep track of created events
-    std::vector<std::shared_ptr<AudioEvent>> m_ActiveEvents;
+    // Dedicated audio thread (idle unless StartAudioThread is called)
+    AudioThread m_AudioThread;
+
+    // Looping emitters managed by priority
+    VirtualVoiceManager m_VirtualVoices;
+
+    // Occlusion queries for tracked events
+    OcclusionSystem m_Occlusion;
+
+    // Every created event; a record is freed when FMOD destroys its instance
+    AudioEventSlotMap m_Events;
+
+    // Stopped/destroyed notifications from the Studio update thread, drained by
+    // CleanupEvents. If the ring ever fills, the next cleanup scans every record.
+    struct EventLifetimeNotice
+    {
+        FMOD::Studio::EventInstance* instance = nullptr;
+        uint32_t slot = 0;
+        FMOD_STUDIO_EVENT_CALLBACK_TYPE type = 0;
+    };
+    MpscRing<EventLifetimeNotice> m_LifetimeNotices{ 8192 };
+    std::atomic<bool> m_LifetimeNoticesDropped{ false };
+    static FMOD_RESULT F_CALL OnEventLifetime(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE* event, void* parameters);
     std::shared_ptr<AudioEvent> m_CurrentMusicTrack = nullptr;
 
-    // Clean up destroyed or finished events
+    // Wrappers dropped while the audio lock was held. Destroying one releases its
+    // handle, which takes the lock, so they are destroyed once Update lets go of it.
+    std::vector<std::shared_ptr<AudioEvent>> m_DroppedEvents;
+    void DropMusicTrack();
+
+    // Under the audio lock
+    AudioEventHandle CreateEventRecord(AudioEventId eventId);
+    void ReleaseEventRecord(AudioEventHandle handle);
+
+    // Restart safe point, and what FMODAudioSystem calls back after any Restart
+    void ApplyPendingRestart();
+    void OnAudioSystemRestart();
+    void ClearEventRecords();
+
+    // Frees the records of events FMOD has destroyed and drops a stopped music track
     void CleanupEvents();
+    void ScanForDestroyedEvents();
+    void UpdateVirtualVoices();
+    void UpdateOcclusion();
 
-    // Time since last FMOD update
-    float m_TimeSinceLastUpdate = 0.0f;
+    // Paces FMOD updates, on this thread or the audio thread
+    AudioTickScheduler m_TickScheduler;
+    void RunAudioTick(bool catchUp);
 };
\ No newline at end of file
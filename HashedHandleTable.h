@@ -0,0 +1,194 @@
+// HashedHandleTable.h - Flat open-addressing table keyed by precomputed path hashes
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Linear-probing hash table for caching FMOD handles by path hash. Lookups are a
+// single probe sequence over contiguous memory with no allocation; erase uses
+// backward-shift deletion so no tombstones accumulate.
+template <typename T>
+class HashedHandleTable
+{
+public:
+    explicit HashedHandleTable(size_t initialCapacity = 64)
+    {
+        size_t capacity = 16;
+        while (capacity < initialCapacity)
+        {
+            capacity <<= 1;
+        }
+        m_Slots.resize(capacity);
+    }
+
+    T* Find(uint64_t hash)
+    {
+        size_t mask = m_Slots.size() - 1;
+        for (size_t i = Home(hash); m_Slots[i].occupied; i = (i + 1) & mask)
+        {
+            if (m_Slots[i].hash == hash)
+            {
+                return &m_Slots[i].value;
+            }
+        }
+        return nullptr;
+    }
+
+    const T* Find(uint64_t hash) const
+    {
+        return const_cast<HashedHandleTable*>(this)->Find(hash);
+    }
+
+    // Inserts or overwrites the value stored for this hash
+    T& Insert(uint64_t hash, const T& value)
+    {
+        if (T* existing = Find(hash))
+        {
+            *existing = value;
+            return *existing;
+        }
+
+        // Keep the load factor under 70%
+        if ((m_Count + 1) * 10 > m_Slots.size() * 7)
+        {
+            Grow();
+        }
+
+        size_t mask = m_Slots.size() - 1;
+        size_t i = Home(hash);
+        while (m_Slots[i].occupied)
+        {
+            i = (i + 1) & mask;
+        }
+
+        m_Slots[i].hash = hash;
+        m_Slots[i].value = value;
+        m_Slots[i].occupied = true;
+        ++m_Count;
+        return m_Slots[i].value;
+    }
+
+    bool Erase(uint64_t hash)
+    {
+        size_t mask = m_Slots.size() - 1;
+        size_t i = Home(hash);
+        while (m_Slots[i].occupied && m_Slots[i].hash != hash)
+        {
+            i = (i + 1) & mask;
+        }
+
+        if (!m_Slots[i].occupied)
+        {
+            return false;
+        }
+
+        RemoveAt(i);
+        return true;
+    }
+
+    // Erases every entry for which pred(hash, value) returns true
+    template <typename Pred>
+    size_t EraseIf(Pred pred)
+    {
+        size_t erased = 0;
+        size_t i = 0;
+        while (i < m_Slots.size())
+        {
+            // RemoveAt may shift a later entry into slot i, so re-check it
+            if (m_Slots[i].occupied && pred(m_Slots[i].hash, m_Slots[i].value))
+            {
+                RemoveAt(i);
+                ++erased;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        return erased;
+    }
+
+    template <typename Fn>
+    void ForEach(Fn fn)
+    {
+        for (Slot& slot : m_Slots)
+        {
+            if (slot.occupied)
+            {
+                fn(slot.hash, slot.value);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (Slot& slot : m_Slots)
+        {
+            slot = Slot();
+        }
+        m_Count = 0;
+    }
+
+    size_t Size() const { return m_Count; }
+    bool Empty() const { return m_Count == 0; }
+
+private:
+    struct Slot
+    {
+        uint64_t hash = 0;
+        T value = T();
+        bool occupied = false;
+    };
+
+    size_t Home(uint64_t hash) const
+    {
+        // Fold the high bits in so short, similar paths still spread out
+        return static_cast<size_t>(hash ^ (hash >> 32)) & (m_Slots.size() - 1);
+    }
+
+    void RemoveAt(size_t hole)
+    {
+        size_t mask = m_Slots.size() - 1;
+        size_t i = hole;
+        for (;;)
+        {
+            i = (i + 1) & mask;
+            if (!m_Slots[i].occupied)
+            {
+                break;
+            }
+
+            // Move the entry back if the hole lies between its home slot and i
+            size_t home = Home(m_Slots[i].hash);
+            bool movable = (hole <= i) ? (home <= hole || home > i) : (home <= hole && home > i);
+            if (movable)
+            {
+                m_Slots[hole] = m_Slots[i];
+                hole = i;
+            }
+        }
+
+        m_Slots[hole] = Slot();
+        --m_Count;
+    }
+
+    void Grow()
+    {
+        std::vector<Slot> old;
+        old.swap(m_Slots);
+        m_Slots.resize(old.size() * 2);
+        m_Count = 0;
+
+        for (const Slot& slot : old)
+        {
+            if (slot.occupied)
+            {
+                Insert(slot.hash, slot.value);
+            }
+        }
+    }
+
+    std::vector<Slot> m_Slots;
+    size_t m_Count = 0;
+};
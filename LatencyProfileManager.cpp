@@ -0,0 +1,175 @@
+// LatencyProfileManager.cpp
+#include "LatencyProfileManager.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace
+{
+    // Measurement window length
+    const std::chrono::milliseconds kWindowLength(1000);
+
+    // A window is starved if the mixer produced less than this share of real time
+    const float kStarvedMixRate = 0.95f;
+
+    // ...or if the mixer thread was this busy (percent) at any sample in the window
+    const float kSaturatedDspCpu = 90.0f;
+
+    // Starved windows tolerated per profile before stepping up
+    const uint32_t kMaxStarvedWindows = 2;
+}
+
+LatencyProfileManager::LatencyProfileManager()
+{
+    // Lowest latency first; the last entry is the old fixed 1024 x 10 setup
+    const DSPBufferProfile profiles[] = {
+        { 256, 4 },
+        { 512, 4 },
+        { 1024, 4 },
+        { 1024, 10 },
+    };
+
+    for (const DSPBufferProfile& profile : profiles)
+    {
+        LatencyProfileStats stats;
+        stats.profile = profile;
+        m_Stats.push_back(stats);
+    }
+}
+
+bool LatencyProfileManager::LoadPersisted()
+{
+    std::ifstream file(m_PersistPath);
+    int index = 0;
+    if (!(file >> index))
+    {
+        return false;
+    }
+
+    m_CurrentIndex = std::clamp(index, 0, static_cast<int>(m_Stats.size()) - 1);
+    return true;
+}
+
+bool LatencyProfileManager::SavePersisted() const
+{
+    std::ofstream file(m_PersistPath, std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    file << m_CurrentIndex << std::endl;
+    return static_cast<bool>(file);
+}
+
+void LatencyProfileManager::OnSystemStarted(FMOD::System* coreSystem)
+{
+    int sampleRate = 0;
+    if (coreSystem->getSoftwareFormat(&sampleRate, nullptr, nullptr) == FMOD_OK && sampleRate > 0)
+    {
+        m_SampleRate = sampleRate;
+    }
+
+    for (LatencyProfileStats& stats : m_Stats)
+    {
+        stats.bufferedLatencyMs = 1000.0f * static_cast<float>(stats.profile.bufferLength * stats.profile.numBuffers) / static_cast<float>(m_SampleRate);
+    }
+
+    m_WindowStarted = false;
+    m_SkipWindow = true;
+    m_CpuTotal = 0.0;
+    m_CpuSamples = 0;
+}
+
+bool LatencyProfileManager::Update(FMOD::System* coreSystem)
+{
+    FMOD::ChannelGroup* master = nullptr;
+    unsigned long long dspClock = 0;
+    if (coreSystem->getMasterChannelGroup(&master) != FMOD_OK || master->getDSPClock(&dspClock, nullptr) != FMOD_OK)
+    {
+        return false;
+    }
+
+    FMOD_CPU_USAGE usage = {};
+    coreSystem->getCPUUsage(&usage);
+
+    auto now = std::chrono::steady_clock::now();
+    if (!m_WindowStarted)
+    {
+        m_WindowStarted = true;
+        m_WindowStart = now;
+        m_WindowStartClock = dspClock;
+        m_WindowCpuTotal = 0.0f;
+        m_WindowCpuSamples = 0;
+        m_WindowCpuPeak = 0.0f;
+        return false;
+    }
+
+    m_WindowCpuTotal += usage.dsp;
+    ++m_WindowCpuSamples;
+    m_WindowCpuPeak = std::max(m_WindowCpuPeak, usage.dsp);
+
+    std::chrono::duration<double> elapsed = now - m_WindowStart;
+    if (elapsed < kWindowLength)
+    {
+        return false;
+    }
+
+    // How much audio the mixer produced compared to how much real time passed
+    double expectedSamples = elapsed.count() * static_cast<double>(m_SampleRate);
+    float mixRate = static_cast<float>(static_cast<double>(dspClock - m_WindowStartClock) / expectedSamples);
+
+    bool skip = m_SkipWindow;
+    m_SkipWindow = false;
+    m_WindowStarted = false;
+    if (skip)
+    {
+        return false;
+    }
+
+    LatencyProfileStats& stats = m_Stats[m_CurrentIndex];
+    ++stats.windows;
+    stats.worstMixRate = std::min(stats.worstMixRate, mixRate);
+    stats.peakDspCpu = std::max(stats.peakDspCpu, m_WindowCpuPeak);
+    m_CpuTotal += m_WindowCpuTotal;
+    m_CpuSamples += m_WindowCpuSamples;
+    stats.averageDspCpu = static_cast<float>(m_CpuTotal / static_cast<double>(std::max<uint64_t>(m_CpuSamples, 1)));
+
+    if (mixRate < kStarvedMixRate || m_WindowCpuPeak > kSaturatedDspCpu)
+    {
+        ++stats.starvedWindows;
+    }
+
+    return stats.starvedWindows > kMaxStarvedWindows && m_CurrentIndex + 1 < static_cast<int>(m_Stats.size());
+}
+
+bool LatencyProfileManager::StepUp()
+{
+    if (m_CurrentIndex + 1 >= static_cast<int>(m_Stats.size()))
+    {
+        return false;
+    }
+
+    ++m_CurrentIndex;
+    return true;
+}
+
+void LatencyProfileManager::PrintReport(std::ostream& out) const
+{
+    std::ios::fmtflags flags = out.flags();
+
+    out << "DSP buffer profiles (buffered latency is the trigger-to-output floor; device latency adds to it):" << std::endl;
+    for (size_t i = 0; i < m_Stats.size(); ++i)
+    {
+        const LatencyProfileStats& stats = m_Stats[i];
+        out << (static_cast<int>(i) == m_CurrentIndex ? " * " : "   ")
+            << stats.profile.bufferLength << " x " << stats.profile.numBuffers
+            << std::fixed << std::setprecision(1)
+            << ": " << stats.bufferedLatencyMs << " ms buffered, "
+            << stats.starvedWindows << "/" << stats.windows << " starved windows, dsp cpu avg "
+            << stats.averageDspCpu << "% peak " << stats.peakDspCpu << "%, worst mix rate "
+            << std::setprecision(3) << stats.worstMixRate << std::endl;
+    }
+
+    out.flags(flags);
+}
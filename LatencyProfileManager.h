@@ -0,0 +1,73 @@
+// LatencyProfileManager.h - Adaptive DSP buffer configuration with starvation detection
+#pragma once
+
+#include <fmod.hpp>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct DSPBufferProfile
+{
+    unsigned int bufferLength = 1024;
+    int numBuffers = 4;
+};
+
+struct LatencyProfileStats
+{
+    DSPBufferProfile profile;
+    float bufferedLatencyMs = 0.0f;  // bufferLength * numBuffers at the output rate
+    uint32_t windows = 0;            // Measurement windows observed
+    uint32_t starvedWindows = 0;     // Windows where the mixer fell behind real time
+    float averageDspCpu = 0.0f;
+    float peakDspCpu = 0.0f;
+    float worstMixRate = 1.0f;       // Lowest mixed-samples / real-time ratio seen
+};
+
+// Starts from the lowest-latency DSP buffer configuration and watches the mixer.
+// Once a window is seen where the master DSP clock advanced noticeably slower than
+// wall time (the device was starved) or mixer CPU was saturated, often enough, it
+// asks for a step up to the next configuration. The chosen profile is persisted
+// so slow machines don't have to re-discover it every launch.
+class LatencyProfileManager
+{
+public:
+    LatencyProfileManager();
+
+    void SetPersistPath(const std::string& path) { m_PersistPath = path; }
+    bool LoadPersisted();
+    bool SavePersisted() const;
+
+    const DSPBufferProfile& GetCurrentProfile() const { return m_Stats[m_CurrentIndex].profile; }
+    int GetCurrentIndex() const { return m_CurrentIndex; }
+    const std::vector<LatencyProfileStats>& GetStats() const { return m_Stats; }
+
+    // Call after the core system has been (re)initialized with the current profile
+    void OnSystemStarted(FMOD::System* coreSystem);
+
+    // Samples the mixer; returns true when the current profile should be abandoned
+    bool Update(FMOD::System* coreSystem);
+
+    // Moves to the next (higher latency) profile; false if already at the last one
+    bool StepUp();
+
+    void PrintReport(std::ostream& out) const;
+
+private:
+    std::vector<LatencyProfileStats> m_Stats;
+    int m_CurrentIndex = 0;
+    std::string m_PersistPath = "audio_latency_profile.cfg";
+
+    // Current measurement window
+    int m_SampleRate = 48000;
+    bool m_WindowStarted = false;
+    bool m_SkipWindow = true;  // The first window after a (re)start includes startup hitches
+    std::chrono::steady_clock::time_point m_WindowStart;
+    unsigned long long m_WindowStartClock = 0;
+    float m_WindowCpuTotal = 0.0f;
+    uint32_t m_WindowCpuSamples = 0;
+    float m_WindowCpuPeak = 0.0f;
+    double m_CpuTotal = 0.0;
+    uint64_t m_CpuSamples = 0;
+};
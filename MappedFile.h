@@ -0,0 +1,33 @@
+// MappedFile.h - Read-only memory-mapped file
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+// Maps a whole file read-only into the address space. The mapping is backed by
+// the OS page cache, so it is shared with any other process mapping the same file.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    const char* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    bool IsOpen() const { return m_Data != nullptr; }
+
+private:
+    const char* m_Data = nullptr;
+    size_t m_Size = 0;
+
+#ifdef _WIN32
+    void* m_FileHandle = nullptr;
+    void* m_MappingHandle = nullptr;
+#endif
+};
@@ -0,0 +1,110 @@
+// MpscRing.h - Lock-free bounded multi-producer single-consumer ring
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded ring with a per-cell sequence number (Vyukov). Any number of threads
+// may Push concurrently without locks; exactly one thread may Pop. Values are
+// copied into preallocated cells, so T should be small and trivially copyable.
+template <typename T>
+class MpscRing
+{
+public:
+    explicit MpscRing(size_t capacity = 4096)
+    {
+        size_t size = 2;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+
+        m_Cells.reset(new Cell[size]);
+        m_Mask = size - 1;
+        for (size_t i = 0; i < size; ++i)
+        {
+            m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Returns false if the ring is full
+    bool Push(const T& value)
+    {
+        Cell* cell = nullptr;
+        size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_Cells[pos & m_Mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                // The cell is free for this lap; claim it
+                if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer hasn't freed this cell yet: the ring is full
+                return false;
+            }
+            else
+            {
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(T& value)
+    {
+        Cell* cell = &m_Cells[m_DequeuePos & m_Mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        if (sequence != m_DequeuePos + 1)
+        {
+            return false;
+        }
+
+        value = cell->value;
+
+        // Hand the cell back to producers for the next lap
+        cell->sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+        ++m_DequeuePos;
+        m_DequeuePosPublished.store(m_DequeuePos, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t GetCapacity() const { return m_Mask + 1; }
+
+    size_t GetApproximateSize() const
+    {
+        size_t enqueued = m_EnqueuePos.load(std::memory_order_relaxed);
+        size_t dequeued = m_DequeuePosPublished.load(std::memory_order_relaxed);
+        return (enqueued > dequeued) ? enqueued - dequeued : 0;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> m_Cells;
+    size_t m_Mask = 0;
+
+    // Keep producer and consumer cursors on separate cache lines
+    alignas(64) std::atomic<size_t> m_EnqueuePos{ 0 };
+    alignas(64) size_t m_DequeuePos = 0;
+    std::atomic<size_t> m_DequeuePosPublished{ 0 };
+};
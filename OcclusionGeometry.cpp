@@ -0,0 +1,171 @@
+// OcclusionGeometry.cpp
+#include "OcclusionGeometry.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    constexpr uint32_t kMaxLeafWalls = 4;
+
+    // Slab test of the segment's bounding interval against a box
+    bool SegmentHitsBox(float ax, float ay, float dx, float dy, float minX, float minY, float maxX, float maxY)
+    {
+        float tMin = 0.0f;
+        float tMax = 1.0f;
+
+        const float origin[2] = { ax, ay };
+        const float direction[2] = { dx, dy };
+        const float boxMin[2] = { minX, minY };
+        const float boxMax[2] = { maxX, maxY };
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (direction[axis] == 0.0f)
+            {
+                if (origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis])
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            float inverse = 1.0f / direction[axis];
+            float t0 = (boxMin[axis] - origin[axis]) * inverse;
+            float t1 = (boxMax[axis] - origin[axis]) * inverse;
+            if (t0 > t1)
+            {
+                std::swap(t0, t1);
+            }
+
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+            if (tMin > tMax)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool SegmentsCross(float ax, float ay, float dx, float dy, const OcclusionWall& wall)
+    {
+        float ex = wall.x1 - wall.x0;
+        float ey = wall.y1 - wall.y0;
+        float denominator = dx * ey - dy * ex;
+        if (denominator == 0.0f)
+        {
+            return false; // Parallel; grazing along a wall doesn't occlude
+        }
+
+        float fx = wall.x0 - ax;
+        float fy = wall.y0 - ay;
+        float t = (fx * ey - fy * ex) / denominator;
+        float u = (fx * dy - fy * dx) / denominator;
+        return t >= 0.0f && t <= 1.0f && u >= 0.0f && u <= 1.0f;
+    }
+}
+
+OcclusionGeometry::OcclusionGeometry(std::vector<OcclusionWall> walls)
+    : m_Walls(std::move(walls))
+{
+    if (!m_Walls.empty())
+    {
+        m_Nodes.reserve(2 * m_Walls.size() / kMaxLeafWalls + 1);
+        m_Nodes.push_back({});
+        Build(0, 0, static_cast<uint32_t>(m_Walls.size()));
+    }
+}
+
+void OcclusionGeometry::Build(uint32_t nodeIndex, uint32_t first, uint32_t count)
+{
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    for (uint32_t i = first; i < first + count; ++i)
+    {
+        const OcclusionWall& wall = m_Walls[i];
+        minX = std::min({ minX, wall.x0, wall.x1 });
+        minY = std::min({ minY, wall.y0, wall.y1 });
+        maxX = std::max({ maxX, wall.x0, wall.x1 });
+        maxY = std::max({ maxY, wall.y0, wall.y1 });
+    }
+
+    Node node = { minX, minY, maxX, maxY, first, count };
+    if (count <= kMaxLeafWalls)
+    {
+        m_Nodes[nodeIndex] = node;
+        return;
+    }
+
+    // Median split on the longer axis by wall midpoint
+    bool splitX = (maxX - minX) >= (maxY - minY);
+    auto middle = m_Walls.begin() + first + count / 2;
+    std::nth_element(m_Walls.begin() + first, middle, m_Walls.begin() + first + count,
+        [splitX](const OcclusionWall& a, const OcclusionWall& b)
+        {
+            return splitX ? (a.x0 + a.x1) < (b.x0 + b.x1) : (a.y0 + a.y1) < (b.y0 + b.y1);
+        });
+
+    // Children are allocated as a pair so the right child is always left + 1
+    uint32_t left = static_cast<uint32_t>(m_Nodes.size());
+    m_Nodes.push_back({});
+    m_Nodes.push_back({});
+
+    node.first = left;
+    node.count = 0;
+    m_Nodes[nodeIndex] = node;
+
+    Build(left, first, count / 2);
+    Build(left + 1, first + count / 2, count - count / 2);
+}
+
+float OcclusionGeometry::Query(float ax, float ay, float bx, float by) const
+{
+    if (m_Nodes.empty())
+    {
+        return 0.0f;
+    }
+
+    float dx = bx - ax;
+    float dy = by - ay;
+    float transmission = 1.0f;
+
+    uint32_t stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const Node& node = m_Nodes[stack[--stackSize]];
+        if (!SegmentHitsBox(ax, ay, dx, dy, node.minX, node.minY, node.maxX, node.maxY))
+        {
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                if (SegmentsCross(ax, ay, dx, dy, m_Walls[i]))
+                {
+                    transmission *= 1.0f - m_Walls[i].occlusion;
+                }
+            }
+        }
+        else
+        {
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = node.first + 1;
+        }
+
+        // Fully blocked; nothing more can change the answer
+        if (transmission <= 0.0f)
+        {
+            return 1.0f;
+        }
+    }
+
+    return 1.0f - transmission;
+}
@@ -0,0 +1,43 @@
+// OcclusionGeometry.h - Bounding volume hierarchy over 2D occluding walls
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A wall segment in the x/y plane. occlusion is how much of the sound it blocks
+// (1 = solid, 0 = transparent).
+struct OcclusionWall
+{
+    float x0 = 0.0f;
+    float y0 = 0.0f;
+    float x1 = 0.0f;
+    float y1 = 0.0f;
+    float occlusion = 1.0f;
+};
+
+// Immutable once built, so any number of threads may query it concurrently.
+class OcclusionGeometry
+{
+public:
+    explicit OcclusionGeometry(std::vector<OcclusionWall> walls);
+
+    // Combined occlusion of every wall crossed by the segment from (ax, ay) to (bx, by):
+    // each wall lets through (1 - occlusion) of what reaches it.
+    float Query(float ax, float ay, float bx, float by) const;
+
+    size_t GetWallCount() const { return m_Walls.size(); }
+
+private:
+    struct Node
+    {
+        float minX, minY, maxX, maxY;
+        uint32_t first; // Leaf: first wall; interior: left child (right child is first + 1)
+        uint32_t count; // Walls in a leaf, 0 for an interior node
+    };
+
+    void Build(uint32_t nodeIndex, uint32_t first, uint32_t count);
+
+    std::vector<OcclusionWall> m_Walls;
+    std::vector<Node> m_Nodes;
+};
@@ -0,0 +1,316 @@
+// OcclusionSystem.cpp
+#include "OcclusionSystem.h"
+#include "AudioEvent.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+    // Smaller changes aren't worth a parameter update
+    constexpr float kMinParameterChange = 0.01f;
+}
+
+OcclusionSystem::~OcclusionSystem()
+{
+    Stop();
+}
+
+bool OcclusionSystem::Start(int workerThreads)
+{
+    if (IsRunning())
+    {
+        return true;
+    }
+
+    if (workerThreads <= 0)
+    {
+        std::cerr << "Occlusion: Worker thread count must be positive" << std::endl;
+        return false;
+    }
+
+    m_StopWorkers = false;
+    for (int i = 0; i < workerThreads; ++i)
+    {
+        m_Workers.emplace_back(&OcclusionSystem::WorkerLoop, this);
+    }
+
+    return true;
+}
+
+void OcclusionSystem::Stop()
+{
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_StopWorkers = true;
+    }
+    m_QueueCondition.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+
+    // Anything still queued runs here so its source isn't left waiting forever
+    for (const Query& query : m_Queries)
+    {
+        m_Results.push_back(RunQuery(query));
+    }
+    m_Queries.clear();
+    m_InFlight = 0;
+}
+
+OcclusionSourceId OcclusionSystem::Track(const std::shared_ptr<AudioEvent>& event, const std::string& parameterName)
+{
+    if (!event || !event->IsValid())
+    {
+        return kInvalidOcclusionSourceId;
+    }
+
+    Source source;
+    source.event = event;
+    source.instance = event->GetRawEventInstance();
+
+    // Called with the FMOD lock already held, so go to the system directly
+    if (!FMODAudioSystem::GetInstance().GetEventParameterId(source.instance, parameterName, source.parameterId))
+    {
+        std::cerr << "Occlusion: Event has no parameter '" << parameterName << "'" << std::endl;
+        return kInvalidOcclusionSourceId;
+    }
+
+    OcclusionSourceId id = m_NextId++;
+    m_Sources.emplace(id, source);
+    return id;
+}
+
+void OcclusionSystem::Untrack(OcclusionSourceId id)
+{
+    // A result still in flight finds no source and is dropped
+    m_Sources.erase(id);
+}
+
+OcclusionSystem::Result OcclusionSystem::RunQuery(const Query& query)
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    Result result;
+    result.id = query.id;
+    result.generation = query.generation;
+    result.occlusion = query.geometry->Query(query.ax, query.ay, query.bx, query.by);
+
+    std::chrono::duration<float, std::micro> queryTime = std::chrono::steady_clock::now() - startTime;
+    result.queryUs = queryTime.count();
+    return result;
+}
+
+void OcclusionSystem::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_QueueMutex);
+    while (true)
+    {
+        m_QueueCondition.wait(lock, [this]() { return m_StopWorkers || !m_Queries.empty(); });
+        if (m_StopWorkers)
+        {
+            return;
+        }
+
+        Query query = std::move(m_Queries.front());
+        m_Queries.pop_front();
+
+        lock.unlock();
+        Result result = RunQuery(query);
+        lock.lock();
+
+        m_Results.push_back(result);
+        --m_InFlight;
+    }
+}
+
+void OcclusionSystem::ApplyResults()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_Completed.swap(m_Results);
+    }
+
+    FMODAudioSystem& audioSystem = FMODAudioSystem::GetInstance();
+    for (const Result& result : m_Completed)
+    {
+        ++m_CompletedQueries;
+        m_TotalQueryUs += result.queryUs;
+        m_MaxQueryUs = std::max(m_MaxQueryUs, result.queryUs);
+
+        auto it = m_Sources.find(result.id);
+        if (result.generation != m_Generation || it == m_Sources.end())
+        {
+            continue;
+        }
+
+        Source& source = it->second;
+        source.inFlight = false;
+        if (std::abs(result.occlusion - source.appliedValue) < kMinParameterChange)
+        {
+            continue;
+        }
+
+        if (audioSystem.SetEventParameterById(source.instance, source.parameterId, result.occlusion))
+        {
+            source.appliedValue = result.occlusion;
+            ++m_ParameterUpdates;
+        }
+    }
+
+    m_Completed.clear();
+}
+
+void OcclusionSystem::Update(const AudioListenerSet& listeners)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    ++m_UpdateCount;
+
+    ApplyResults();
+
+    m_QueriesLastUpdate = 0;
+    if (!m_Geometry || m_Sources.empty())
+    {
+        m_LastScheduleMs = 0.0f;
+        return;
+    }
+
+    // Rank sources by distance to the nearest listener, divided by how stale they are.
+    // Cached positions keep this loop off FMOD; a source never queried ranks first.
+    m_Candidates.clear();
+    for (auto it = m_Sources.begin(); it != m_Sources.end();)
+    {
+        Source& source = it->second;
+        if (source.event.expired())
+        {
+            it = m_Sources.erase(it);
+            continue;
+        }
+
+        if (!source.inFlight)
+        {
+            float distanceSquared = source.hasPosition ? listeners.NearestDistanceSquared(source.x, source.y) : 0.0f;
+            // Age is squared to stay in the same units as the squared distance
+            float age = static_cast<float>(m_UpdateCount - source.queriedUpdate);
+            Candidate candidate;
+            candidate.rank = distanceSquared / (1.0f + age * age);
+            candidate.id = it->first;
+            m_Candidates.push_back(candidate);
+        }
+        ++it;
+    }
+
+    size_t candidateCount = std::min(m_Candidates.size(), static_cast<size_t>(std::max(m_Budget, 0)));
+    std::partial_sort(m_Candidates.begin(), m_Candidates.begin() + candidateCount, m_Candidates.end(),
+        [](const Candidate& a, const Candidate& b) { return a.rank < b.rank; });
+
+    std::vector<Query> queries;
+    queries.reserve(candidateCount);
+    for (size_t i = 0; i < candidateCount; ++i)
+    {
+        auto it = m_Sources.find(m_Candidates[i].id);
+        Source& source = it->second;
+
+        // Only the budgeted sources read their position back from FMOD
+        FMOD_3D_ATTRIBUTES attributes = {};
+        if (source.instance->get3DAttributes(&attributes) != FMOD_OK)
+        {
+            m_Sources.erase(it);
+            continue;
+        }
+        source.x = attributes.position.x;
+        source.y = attributes.position.y;
+        source.hasPosition = true;
+
+        // Trace from whichever listener is nearest to the source
+        Query query;
+        query.id = it->first;
+        query.generation = m_Generation;
+        query.geometry = m_Geometry;
+        query.ax = source.x;
+        query.ay = source.y;
+        query.bx = listeners.x[0];
+        query.by = listeners.y[0];
+        float nearest = -1.0f;
+        for (int l = 0; l < listeners.count; ++l)
+        {
+            float dx = query.ax - listeners.x[l];
+            float dy = query.ay - listeners.y[l];
+            float distanceSquared = dx * dx + dy * dy;
+            if (nearest < 0.0f || distanceSquared < nearest)
+            {
+                nearest = distanceSquared;
+                query.bx = listeners.x[l];
+                query.by = listeners.y[l];
+            }
+        }
+
+        source.inFlight = true;
+        source.queriedUpdate = m_UpdateCount;
+        queries.push_back(std::move(query));
+    }
+    size_t queryCount = queries.size();
+
+    if (IsRunning())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_InFlight += static_cast<int>(queries.size());
+            for (Query& query : queries)
+            {
+                m_Queries.push_back(std::move(query));
+            }
+        }
+        m_QueueCondition.notify_all();
+    }
+    else
+    {
+        // No workers: run now, apply next Update like a worker result would
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        for (const Query& query : queries)
+        {
+            m_Results.push_back(RunQuery(query));
+        }
+    }
+
+    m_QueriesLastUpdate = static_cast<int>(queryCount);
+    m_TotalQueries += queryCount;
+
+    std::chrono::duration<float, std::milli> scheduleTime = std::chrono::steady_clock::now() - startTime;
+    m_LastScheduleMs = scheduleTime.count();
+}
+
+void OcclusionSystem::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+    m_InFlight -= static_cast<int>(m_Queries.size());
+    m_Queries.clear();
+    m_Results.clear();
+    m_Sources.clear();
+    ++m_Generation;
+}
+
+OcclusionStats OcclusionSystem::GetStats() const
+{
+    OcclusionStats stats;
+    stats.trackedSources = static_cast<int>(m_Sources.size());
+    stats.queriesLastUpdate = m_QueriesLastUpdate;
+    stats.totalQueries = m_TotalQueries;
+    stats.parameterUpdates = m_ParameterUpdates;
+    stats.maxQueryUs = m_MaxQueryUs;
+    stats.lastScheduleMs = m_LastScheduleMs;
+    stats.averageQueryUs = m_CompletedQueries > 0 ? static_cast<float>(m_TotalQueryUs / m_CompletedQueries) : 0.0f;
+
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+    stats.pendingResults = m_InFlight;
+    return stats;
+}
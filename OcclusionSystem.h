@@ -0,0 +1,133 @@
+// OcclusionSystem.h - Amortized listener-to-emitter occlusion on worker threads
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "AudioListenerSet.h"
+#include "OcclusionGeometry.h"
+
+class AudioEvent;
+
+using OcclusionSourceId = uint32_t;
+constexpr OcclusionSourceId kInvalidOcclusionSourceId = 0;
+
+struct OcclusionStats
+{
+    int trackedSources = 0;
+    int queriesLastUpdate = 0;  // Queries scheduled by the last Update
+    int pendingResults = 0;     // Queries still running on a worker
+    uint64_t totalQueries = 0;
+    uint64_t parameterUpdates = 0; // setParameterByID calls made
+    float averageQueryUs = 0.0f;   // Time spent inside the BVH per query
+    float maxQueryUs = 0.0f;
+    float lastScheduleMs = 0.0f;   // Main-thread cost of the last Update
+};
+
+// Tracks events that should be occluded by level walls. Each Update applies the
+// results that finished since the last one, then schedules at most the budgeted
+// number of new queries: sources are ranked by distance to their nearest listener,
+// scaled down by how many updates since they were last queried, so near sources
+// refresh every frame and far ones still get their turn. Ranking uses each source's
+// position as of its last query; only the sources picked read their position back
+// from FMOD. Queries run against an
+// immutable BVH snapshot on the worker threads (or inline if none were started),
+// and the result lands on each event's occlusion parameter one update later.
+class OcclusionSystem
+{
+public:
+    ~OcclusionSystem();
+
+    // Starts the worker threads; with no workers queries run inside Update
+    bool Start(int workerThreads = 2);
+    void Stop();
+    bool IsRunning() const { return !m_Workers.empty(); }
+
+    // Replaces the level geometry; queries already in flight finish against the old walls
+    void SetGeometry(std::shared_ptr<const OcclusionGeometry> geometry) { m_Geometry = std::move(geometry); }
+    void SetBudget(int queriesPerUpdate) { m_Budget = queriesPerUpdate; }
+
+    // The parameter must exist on the event; it receives 0 (clear) to 1 (fully occluded)
+    OcclusionSourceId Track(const std::shared_ptr<AudioEvent>& event, const std::string& parameterName = "Occlusion");
+    void Untrack(OcclusionSourceId id);
+
+    // Applies finished results and schedules new queries; call once per FMOD update
+    void Update(const AudioListenerSet& listeners);
+
+    // Forgets every source; results still in flight are discarded
+    void Clear();
+
+    OcclusionStats GetStats() const;
+
+private:
+    struct Source
+    {
+        std::weak_ptr<AudioEvent> event;
+        FMOD::Studio::EventInstance* instance = nullptr;
+        FMOD_STUDIO_PARAMETER_ID parameterId = {};
+        float appliedValue = -1.0f; // Nothing applied yet
+        float x = 0.0f;             // Position when last queried
+        float y = 0.0f;
+        bool hasPosition = false;
+        uint32_t queriedUpdate = 0;
+        bool inFlight = false;
+    };
+
+    struct Query
+    {
+        OcclusionSourceId id = kInvalidOcclusionSourceId;
+        uint32_t generation = 0;
+        float ax, ay, bx, by;
+        std::shared_ptr<const OcclusionGeometry> geometry;
+    };
+
+    struct Result
+    {
+        OcclusionSourceId id = kInvalidOcclusionSourceId;
+        uint32_t generation = 0;
+        float occlusion = 0.0f;
+        float queryUs = 0.0f;
+    };
+
+    void WorkerLoop();
+    static Result RunQuery(const Query& query);
+    void ApplyResults();
+
+    int m_Budget = 16;
+    OcclusionSourceId m_NextId = 1;
+    uint32_t m_UpdateCount = 0;
+    uint32_t m_Generation = 0; // Bumped by Clear so stale results are ignored
+    std::unordered_map<OcclusionSourceId, Source> m_Sources;
+    struct Candidate
+    {
+        float rank = 0.0f;
+        OcclusionSourceId id = kInvalidOcclusionSourceId;
+    };
+    std::vector<Candidate> m_Candidates;
+    std::shared_ptr<const OcclusionGeometry> m_Geometry;
+
+    // Job queue shared with the workers
+    std::vector<std::thread> m_Workers;
+    mutable std::mutex m_QueueMutex;
+    std::condition_variable m_QueueCondition;
+    std::deque<Query> m_Queries; // Oldest first, so each update's queries finish in order
+    std::vector<Result> m_Results;
+    std::vector<Result> m_Completed;
+    bool m_StopWorkers = false;
+    int m_InFlight = 0;
+
+    int m_QueriesLastUpdate = 0;
+    uint64_t m_TotalQueries = 0;
+    uint64_t m_CompletedQueries = 0;
+    uint64_t m_ParameterUpdates = 0;
+    double m_TotalQueryUs = 0.0;
+    float m_MaxQueryUs = 0.0f;
+    float m_LastScheduleMs = 0.0f;
+};
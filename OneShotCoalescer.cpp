@@ -0,0 +1,133 @@
+// OneShotCoalescer.cpp
+#include "OneShotCoalescer.h"
+
+void OneShotCoalescer::SetCoalescing(bool enabled, float radius)
+{
+    m_Coalescing = enabled;
+    m_RadiusSquared = radius * radius;
+}
+
+void OneShotCoalescer::SetRules(uint64_t hash, const OneShotRules& rules)
+{
+    RuleState state;
+    state.rules = rules;
+    state.tokens = static_cast<float>(rules.maxPerSecond);
+    state.lastRefill = std::chrono::steady_clock::now();
+    m_Rules.Insert(hash, state);
+}
+
+const OneShotRules* OneShotCoalescer::GetRules(uint64_t hash) const
+{
+    const RuleState* state = m_Rules.Find(hash);
+    return (state != nullptr) ? &state->rules : nullptr;
+}
+
+void OneShotCoalescer::Submit(uint64_t hash, FMOD::Studio::EventDescription* description, const FMOD_VECTOR& position)
+{
+    ++m_Stats.submitted;
+
+    if (m_Coalescing)
+    {
+        // A frame holds few requests, so a linear scan beats any index
+        for (CoalescedOneShot& pending : m_Pending)
+        {
+            if (pending.hash != hash)
+            {
+                continue;
+            }
+
+            float dx = position.x - pending.position.x;
+            float dy = position.y - pending.position.y;
+            float dz = position.z - pending.position.z;
+            if (dx * dx + dy * dy + dz * dz > m_RadiusSquared)
+            {
+                continue;
+            }
+
+            // Keep the merged play at the centroid of its requests
+            float weight = 1.0f / static_cast<float>(pending.count + 1);
+            pending.position.x += dx * weight;
+            pending.position.y += dy * weight;
+            pending.position.z += dz * weight;
+            ++pending.count;
+            ++m_Stats.coalesced;
+            return;
+        }
+    }
+
+    CoalescedOneShot request;
+    request.hash = hash;
+    request.description = description;
+    request.position = position;
+    request.count = 1;
+    m_Pending.push_back(request);
+}
+
+bool OneShotCoalescer::Admit(RuleState& state, std::chrono::steady_clock::time_point now)
+{
+    const OneShotRules& rules = state.rules;
+
+    if (rules.cooldownSeconds > 0.0f && state.hasPlayed)
+    {
+        std::chrono::duration<float> sinceLast = now - state.lastPlay;
+        if (sinceLast.count() < rules.cooldownSeconds)
+        {
+            return false;
+        }
+    }
+
+    if (rules.maxPerSecond > 0)
+    {
+        // Token bucket: refills at maxPerSecond, holds at most one second's worth
+        std::chrono::duration<float> elapsed = now - state.lastRefill;
+        float capacity = static_cast<float>(rules.maxPerSecond);
+        state.tokens += elapsed.count() * capacity;
+        if (state.tokens > capacity)
+        {
+            state.tokens = capacity;
+        }
+        state.lastRefill = now;
+
+        if (state.tokens < 1.0f)
+        {
+            return false;
+        }
+        state.tokens -= 1.0f;
+    }
+
+    state.hasPlayed = true;
+    state.lastPlay = now;
+    return true;
+}
+
+const std::vector<CoalescedOneShot>& OneShotCoalescer::Flush()
+{
+    m_Ready.clear();
+    if (m_Pending.empty())
+    {
+        return m_Ready;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for (const CoalescedOneShot& request : m_Pending)
+    {
+        RuleState* state = m_Rules.Find(request.hash);
+        if (state != nullptr && !Admit(*state, now))
+        {
+            ++m_Stats.rateLimited;
+            continue;
+        }
+
+        m_Ready.push_back(request);
+        ++m_Stats.flushed;
+    }
+
+    m_Pending.clear();
+    return m_Ready;
+}
+
+void OneShotCoalescer::Clear()
+{
+    m_Pending.clear();
+    m_Ready.clear();
+}
@@ -0,0 +1,80 @@
+// OneShotCoalescer.h - Per-frame merging and rate limiting of one-shot requests
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "HashedHandleTable.h"
+
+// Per-event limits applied when a frame's one-shots are flushed
+struct OneShotRules
+{
+    float cooldownSeconds = 0.0f; // Minimum time between plays; 0 = none
+    int maxPerSecond = 0;         // Sustained plays per second (bursts up to this many); 0 = unlimited
+    std::string countParameter;   // If set, receives how many requests were merged into the play
+};
+
+struct OneShotCoalescerStats
+{
+    uint64_t submitted = 0;   // Requests that reached the coalescer
+    uint64_t coalesced = 0;   // Requests merged into an earlier one this frame
+    uint64_t rateLimited = 0; // Merged requests dropped by cooldown or max-per-second
+    uint64_t flushed = 0;     // Merged requests handed on to be played
+};
+
+// A frame's requests for one event near one spot, merged into a single play
+struct CoalescedOneShot
+{
+    uint64_t hash = 0;
+    FMOD::Studio::EventDescription* description = nullptr;
+    FMOD_VECTOR position = { 0.0f, 0.0f, 0.0f }; // Centroid of the merged requests
+    int count = 0;
+};
+
+// Collects one-shot requests during a frame. Requests for the same event within the
+// coalescing radius of an earlier request are merged into it; at the end of the frame
+// each merged request is checked against its event's rules and handed on to be played.
+class OneShotCoalescer
+{
+public:
+    void SetCoalescing(bool enabled, float radius);
+    void SetRules(uint64_t hash, const OneShotRules& rules);
+    void ClearRules(uint64_t hash) { m_Rules.Erase(hash); }
+    const OneShotRules* GetRules(uint64_t hash) const;
+
+    // False when a request for the event can skip the coalescer and play right away:
+    // coalescing is off and the event has no rules
+    bool ShouldDefer(uint64_t hash) const { return m_Coalescing || m_Rules.Find(hash) != nullptr; }
+
+    void Submit(uint64_t hash, FMOD::Studio::EventDescription* description, const FMOD_VECTOR& position);
+
+    // Applies the rules to this frame's requests and returns the ones to play.
+    // The result stays valid until the next Flush.
+    const std::vector<CoalescedOneShot>& Flush();
+
+    void Clear();
+
+    const OneShotCoalescerStats& GetStats() const { return m_Stats; }
+
+private:
+    struct RuleState
+    {
+        OneShotRules rules;
+        float tokens = 0.0f;
+        bool hasPlayed = false;
+        std::chrono::steady_clock::time_point lastPlay;
+        std::chrono::steady_clock::time_point lastRefill;
+    };
+
+    bool Admit(RuleState& state, std::chrono::steady_clock::time_point now);
+
+    bool m_Coalescing = false;
+    float m_RadiusSquared = 1.0f;
+
+    HashedHandleTable<RuleState> m_Rules;
+    std::vector<CoalescedOneShot> m_Pending;
+    std::vector<CoalescedOneShot> m_Ready;
+    OneShotCoalescerStats m_Stats;
+};
@@ -0,0 +1,275 @@
+// ReverbZoneManager.cpp
+#include "ReverbZoneManager.h"
+#include <fmod_errors.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+    // FMOD's floor for WetLevel, as used by FMOD_PRESET_OFF
+    constexpr float kSilentWetLevel = -80.0f;
+
+    // Smoothing factor for the per-active-count DSP CPU averages
+    constexpr float kCpuSmoothing = 0.1f;
+}
+
+ReverbZoneManager::ReverbZoneManager()
+{
+    std::fill(std::begin(m_DspCpuByActiveCount), std::end(m_DspCpuByActiveCount), -1.0f);
+}
+
+ReverbZoneId ReverbZoneManager::AddZone(float x, float y, float minDistance, float maxDistance, const FMOD_REVERB_PROPERTIES& properties)
+{
+    if (maxDistance <= 0.0f || minDistance > maxDistance)
+    {
+        std::cerr << "FMOD: Invalid reverb zone radii (" << minDistance << ", " << maxDistance << ")" << std::endl;
+        return kInvalidReverbZoneId;
+    }
+
+    ReverbZoneId id = m_NextId++;
+
+    Zone zone;
+    zone.x = x;
+    zone.y = y;
+    zone.minDistance = minDistance;
+    zone.maxDistance = maxDistance;
+    zone.properties = properties;
+    m_Zones.emplace(id, zone);
+
+    m_Grid.Insert(id, x, y);
+    m_QueryRadius = std::max(m_QueryRadius, maxDistance);
+    return id;
+}
+
+void ReverbZoneManager::RemoveZone(ReverbZoneId id)
+{
+    auto it = m_Zones.find(id);
+    if (it == m_Zones.end())
+    {
+        return;
+    }
+
+    if (it->second.reverb != nullptr)
+    {
+        Deactivate(it->second);
+        m_Active.erase(std::find(m_Active.begin(), m_Active.end(), id));
+    }
+
+    float maxDistance = it->second.maxDistance;
+    m_Grid.Remove(id);
+    m_Zones.erase(it);
+
+    if (maxDistance >= m_QueryRadius)
+    {
+        RecomputeQueryRadius();
+    }
+}
+
+bool ReverbZoneManager::SetZoneProperties(ReverbZoneId id, const FMOD_REVERB_PROPERTIES& properties)
+{
+    auto it = m_Zones.find(id);
+    if (it == m_Zones.end())
+    {
+        return false;
+    }
+
+    // Sent on the next Update if the zone is active
+    it->second.properties = properties;
+    it->second.appliedWeight = -1.0f;
+    return true;
+}
+
+void ReverbZoneManager::RecomputeQueryRadius()
+{
+    m_QueryRadius = 0.0f;
+    for (const auto& entry : m_Zones)
+    {
+        m_QueryRadius = std::max(m_QueryRadius, entry.second.maxDistance);
+    }
+}
+
+bool ReverbZoneManager::Activate(FMOD::System* coreSystem, Zone& zone)
+{
+    FMOD::Reverb3D* reverb = nullptr;
+    if (!m_Pool.empty())
+    {
+        reverb = m_Pool.back();
+        m_Pool.pop_back();
+    }
+    else
+    {
+        FMOD_RESULT result = coreSystem->createReverb3D(&reverb);
+        if (result != FMOD_OK)
+        {
+            std::cerr << "FMOD: Failed to create reverb: " << FMOD_ErrorString(result) << std::endl;
+            return false;
+        }
+        ++m_ReverbsCreated;
+    }
+
+    FMOD_VECTOR position = { zone.x, zone.y, 0.0f };
+    reverb->set3DAttributes(&position, zone.minDistance, zone.maxDistance);
+
+    // Fades in from silent
+    zone.reverb = reverb;
+    zone.weight = 0.0f;
+    zone.appliedWeight = -1.0f;
+    ApplyWeight(zone);
+    reverb->setActive(true);
+
+    ++m_Activations;
+    return true;
+}
+
+void ReverbZoneManager::Deactivate(Zone& zone)
+{
+    zone.reverb->setActive(false);
+    m_Pool.push_back(zone.reverb);
+    zone.reverb = nullptr;
+    zone.weight = 0.0f;
+    zone.appliedWeight = -1.0f;
+}
+
+void ReverbZoneManager::ApplyWeight(Zone& zone)
+{
+    if (zone.weight == zone.appliedWeight)
+    {
+        return;
+    }
+
+    // Ramp the wet level in linear gain so the fade sounds even
+    FMOD_REVERB_PROPERTIES properties = zone.properties;
+    if (zone.weight < 1.0f)
+    {
+        float wetLevel = (zone.weight > 0.0f) ? properties.WetLevel + 20.0f * std::log10(zone.weight) : kSilentWetLevel;
+        properties.WetLevel = std::max(wetLevel, kSilentWetLevel);
+    }
+
+    zone.reverb->setProperties(&properties);
+    zone.appliedWeight = zone.weight;
+}
+
+void ReverbZoneManager::Update(FMOD::System* coreSystem, const AudioListenerSet& listeners)
+{
+    auto now = std::chrono::steady_clock::now();
+    float deltaSeconds = m_HasUpdated ? std::chrono::duration<float>(now - m_LastUpdate).count() : 0.0f;
+    m_LastUpdate = now;
+    m_HasUpdated = true;
+
+    // Candidates: zones whose outer radius reaches an active listener, ranked by how
+    // far into the fade-out region that listener is (0 inside the inner radius)
+    m_Candidates.clear();
+    if (!m_Zones.empty())
+    {
+        m_Nearby.clear();
+        for (int l = 0; l < listeners.count; ++l)
+        {
+            m_Grid.QueryRadius(listeners.x[l], listeners.y[l], m_QueryRadius, m_Nearby);
+        }
+
+        for (uint32_t id : m_Nearby)
+        {
+            const Zone& zone = m_Zones.find(id)->second;
+            float distance = std::sqrt(listeners.NearestDistanceSquared(zone.x, zone.y));
+            if (distance > zone.maxDistance)
+            {
+                continue;
+            }
+
+            float fadeRange = zone.maxDistance - zone.minDistance;
+            float rank = (distance <= zone.minDistance || fadeRange <= 0.0f) ? 0.0f : (distance - zone.minDistance) / fadeRange;
+            m_Candidates.emplace_back(rank, id);
+        }
+
+        // The same zone can be found from several listeners
+        std::sort(m_Candidates.begin(), m_Candidates.end());
+        m_Candidates.erase(std::unique(m_Candidates.begin(), m_Candidates.end()), m_Candidates.end());
+    }
+
+    for (ReverbZoneId id : m_Active)
+    {
+        m_Zones.find(id)->second.selected = false;
+    }
+
+    size_t selectCount = std::min(m_Candidates.size(), static_cast<size_t>(std::max(m_MaxActiveZones, 0)));
+    for (size_t i = 0; i < selectCount; ++i)
+    {
+        Zone& zone = m_Zones.find(m_Candidates[i].second)->second;
+        zone.selected = true;
+        if (zone.reverb == nullptr && Activate(coreSystem, zone))
+        {
+            m_Active.push_back(m_Candidates[i].second);
+        }
+    }
+
+    // Ramp toward the target weights; zones that have faded out go back to the pool
+    float step = (m_TransitionSeconds > 0.0f) ? deltaSeconds / m_TransitionSeconds : 1.0f;
+    for (size_t i = 0; i < m_Active.size();)
+    {
+        Zone& zone = m_Zones.find(m_Active[i])->second;
+        zone.weight = zone.selected ? std::min(zone.weight + step, 1.0f) : std::max(zone.weight - step, 0.0f);
+
+        if (!zone.selected && zone.weight <= 0.0f)
+        {
+            Deactivate(zone);
+            m_Active[i] = m_Active.back();
+            m_Active.pop_back();
+            continue;
+        }
+
+        ApplyWeight(zone);
+        ++i;
+    }
+
+    // Mixer cost, bucketed by how many reverbs were active
+    FMOD_CPU_USAGE usage = {};
+    if (coreSystem->getCPUUsage(&usage) == FMOD_OK)
+    {
+        m_DspCpu = usage.dsp;
+
+        float& average = m_DspCpuByActiveCount[std::min(m_Active.size(), static_cast<size_t>(kMaxTrackedActiveReverbs))];
+        average = (average < 0.0f) ? usage.dsp : average + (usage.dsp - average) * kCpuSmoothing;
+    }
+}
+
+void ReverbZoneManager::ReleaseReverbs()
+{
+    for (ReverbZoneId id : m_Active)
+    {
+        Zone& zone = m_Zones.find(id)->second;
+        zone.reverb->release();
+        zone.reverb = nullptr;
+        zone.weight = 0.0f;
+        zone.appliedWeight = -1.0f;
+        zone.selected = false;
+    }
+    m_Active.clear();
+
+    for (FMOD::Reverb3D* reverb : m_Pool)
+    {
+        reverb->release();
+    }
+    m_Pool.clear();
+}
+
+void ReverbZoneManager::Clear()
+{
+    ReleaseReverbs();
+    m_Zones.clear();
+    m_Grid.Clear();
+    m_QueryRadius = 0.0f;
+}
+
+ReverbZoneStats ReverbZoneManager::GetStats() const
+{
+    ReverbZoneStats stats;
+    stats.zones = static_cast<int>(m_Zones.size());
+    stats.activeReverbs = static_cast<int>(m_Active.size());
+    stats.pooledReverbs = static_cast<int>(m_Pool.size());
+    stats.reverbsCreated = m_ReverbsCreated;
+    stats.activations = m_Activations;
+    stats.dspCpu = m_DspCpu;
+    std::copy(std::begin(m_DspCpuByActiveCount), std::end(m_DspCpuByActiveCount), stats.dspCpuByActiveCount);
+    return stats;
+}
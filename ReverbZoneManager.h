@@ -0,0 +1,102 @@
+// ReverbZoneManager.h - Spatially indexed reverb zones backed by pooled Reverb3D objects
+#pragma once
+
+#include <fmod.hpp>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "AudioListenerSet.h"
+#include "SpatialHashGrid.h"
+
+using ReverbZoneId = uint32_t;
+constexpr ReverbZoneId kInvalidReverbZoneId = 0;
+
+constexpr int kMaxTrackedActiveReverbs = 8;
+
+struct ReverbZoneStats
+{
+    int zones = 0;
+    int activeReverbs = 0;  // Reverb3D objects currently audible (including fading out)
+    int pooledReverbs = 0;  // Idle Reverb3D objects ready for reuse
+    uint64_t reverbsCreated = 0;
+    uint64_t activations = 0;
+    float dspCpu = 0.0f;    // Mixer DSP CPU (%) at the last Update
+    // Smoothed mixer DSP CPU (%) observed while N reverbs were active, so the cost of
+    // each extra zone can be read off the differences; negative if never observed
+    float dspCpuByActiveCount[kMaxTrackedActiveReverbs + 1] = {};
+};
+
+// Reverb zones are spheres (a full-wet inner radius and a fade-out outer radius, as in
+// Reverb3D::set3DAttributes) kept in a spatial hash grid. Each Update only the zones
+// whose outer radius reaches an active listener are candidates, and at most the
+// configured number of them, nearest first, hold a Reverb3D. Reverb3D objects are
+// taken from and returned to a pool rather than created and released. Zones entering
+// or leaving the active set have their wet level ramped over the transition time so
+// there is no step in the reverb.
+class ReverbZoneManager
+{
+public:
+    ReverbZoneManager();
+
+    ReverbZoneId AddZone(float x, float y, float minDistance, float maxDistance, const FMOD_REVERB_PROPERTIES& properties);
+    void RemoveZone(ReverbZoneId id);
+    bool SetZoneProperties(ReverbZoneId id, const FMOD_REVERB_PROPERTIES& properties);
+
+    void SetMaxActiveZones(int maxActiveZones) { m_MaxActiveZones = maxActiveZones; }
+    void SetTransitionTime(float seconds) { m_TransitionSeconds = seconds; }
+
+    // Picks and blends the active zones; call once per FMOD update
+    void Update(FMOD::System* coreSystem, const AudioListenerSet& listeners);
+
+    // Releases every Reverb3D but keeps the zones, so they come back on the next
+    // Update after a core system restart
+    void ReleaseReverbs();
+
+    // Releases every Reverb3D and forgets all zones
+    void Clear();
+
+    ReverbZoneStats GetStats() const;
+
+private:
+    struct Zone
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        float minDistance = 0.0f;
+        float maxDistance = 0.0f;
+        FMOD_REVERB_PROPERTIES properties = {};
+
+        FMOD::Reverb3D* reverb = nullptr;
+        float weight = 0.0f;        // 0..1 ramp applied to the wet level
+        float appliedWeight = -1.0f; // Weight last sent with setProperties
+        bool selected = false;
+    };
+
+    bool Activate(FMOD::System* coreSystem, Zone& zone);
+    void Deactivate(Zone& zone);
+    void ApplyWeight(Zone& zone);
+    void RecomputeQueryRadius();
+
+    int m_MaxActiveZones = 4;
+    float m_TransitionSeconds = 0.5f;
+
+    ReverbZoneId m_NextId = 1;
+    std::unordered_map<ReverbZoneId, Zone> m_Zones;
+    SpatialHashGrid m_Grid;
+    float m_QueryRadius = 0.0f; // Largest outer radius of any zone
+
+    // Zones holding a Reverb3D, and the idle pool
+    std::vector<ReverbZoneId> m_Active;
+    std::vector<FMOD::Reverb3D*> m_Pool;
+
+    std::vector<uint32_t> m_Nearby;
+    std::vector<std::pair<float, ReverbZoneId>> m_Candidates;
+    std::chrono::steady_clock::time_point m_LastUpdate;
+    bool m_HasUpdated = false;
+
+    uint64_t m_ReverbsCreated = 0;
+    uint64_t m_Activations = 0;
+    float m_DspCpu = 0.0f;
+    float m_DspCpuByActiveCount[kMaxTrackedActiveReverbs + 1];
+};
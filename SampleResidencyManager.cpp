@@ -0,0 +1,117 @@
+// SampleResidencyManager.cpp
+#include "SampleResidencyManager.h"
+#include <iostream>
+
+void SampleResidencyManager::Touch(FMOD::Studio::EventDescription* description)
+{
+    auto it = m_Entries.find(description);
+    if (it != m_Entries.end())
+    {
+        // Move to the front of the LRU list
+        m_Lru.splice(m_Lru.begin(), m_Lru, it->second);
+        return;
+    }
+
+    // Loading is asynchronous; instances started before it completes wait for it
+    if (description->loadSampleData() != FMOD_OK)
+    {
+        std::cerr << "FMOD: Failed to load event sample data!" << std::endl;
+        return;
+    }
+
+    Entry entry;
+    entry.description = description;
+    entry.bytes = m_DefaultDescriptionBytes;
+    m_Lru.push_front(entry);
+    m_Entries[description] = m_Lru.begin();
+
+    m_ResidentBytes += entry.bytes;
+    ++m_Loads;
+}
+
+void SampleResidencyManager::OnInstanceCreated(FMOD::Studio::EventDescription* description, FMOD::Studio::EventInstance* instance)
+{
+    auto it = m_Entries.find(description);
+    if (it == m_Entries.end() || it->second->measured)
+    {
+        return;
+    }
+
+    Entry& entry = *it->second;
+    entry.measured = true;
+
+    FMOD_STUDIO_MEMORY_USAGE usage = {};
+    if (instance->getMemoryUsage(&usage) == FMOD_OK && usage.sampledata > 0)
+    {
+        m_ResidentBytes = m_ResidentBytes - entry.bytes + static_cast<size_t>(usage.sampledata);
+        entry.bytes = static_cast<size_t>(usage.sampledata);
+    }
+}
+
+void SampleResidencyManager::Update(const std::function<bool(FMOD::Studio::EventDescription*)>& releaseIdle)
+{
+    if (m_ResidentBytes <= m_BudgetBytes)
+    {
+        return;
+    }
+
+    // Walk from the least recently used end, skipping anything still playing
+    auto it = m_Lru.end();
+    while (it != m_Lru.begin() && m_ResidentBytes > m_BudgetBytes)
+    {
+        --it;
+
+        int instanceCount = 0;
+        it->description->getInstanceCount(&instanceCount);
+        if (instanceCount > 0)
+        {
+            if (releaseIdle)
+            {
+                releaseIdle(it->description);
+            }
+            continue;
+        }
+
+        it->description->unloadSampleData();
+        m_ResidentBytes -= it->bytes;
+        ++m_Evictions;
+
+        m_Entries.erase(it->description);
+        it = m_Lru.erase(it);
+    }
+}
+
+void SampleResidencyManager::RemoveInvalid()
+{
+    for (auto it = m_Lru.begin(); it != m_Lru.end();)
+    {
+        if (!it->description->isValid())
+        {
+            m_ResidentBytes -= it->bytes;
+            m_Entries.erase(it->description);
+            it = m_Lru.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void SampleResidencyManager::Clear()
+{
+    m_Lru.clear();
+    m_Entries.clear();
+    m_ResidentBytes = 0;
+}
+
+SampleResidencyStats SampleResidencyManager::GetStats() const
+{
+    SampleResidencyStats stats;
+    stats.budgetBytes = m_BudgetBytes;
+    stats.residentBytes = m_ResidentBytes;
+    stats.residentDescriptions = m_Entries.size();
+    stats.loads = m_Loads;
+    stats.evictions = m_Evictions;
+    return stats;
+}
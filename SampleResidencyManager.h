@@ -0,0 +1,67 @@
+// SampleResidencyManager.h - On-demand event sample data with LRU eviction
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+struct SampleResidencyStats
+{
+    size_t budgetBytes = 0;
+    size_t residentBytes = 0;
+    size_t residentDescriptions = 0;
+    uint64_t loads = 0;
+    uint64_t evictions = 0;
+};
+
+// Loads sample data per EventDescription the first time it is used (or when
+// prefetched) instead of per bank, and unloads the least recently used
+// descriptions that have no live instances once the byte budget is exceeded.
+class SampleResidencyManager
+{
+public:
+    void SetBudget(size_t budgetBytes) { m_BudgetBytes = budgetBytes; }
+
+    // Size charged for a description whose sample data size FMOD can't report
+    // (EventInstance::getMemoryUsage only reports sample data in logging builds)
+    void SetDefaultDescriptionBytes(size_t bytes) { m_DefaultDescriptionBytes = bytes; }
+
+    // Marks a description as used, loading its sample data if it isn't resident
+    void Touch(FMOD::Studio::EventDescription* description);
+
+    // Refines the description's size from a live instance
+    void OnInstanceCreated(FMOD::Studio::EventDescription* description, FMOD::Studio::EventInstance* instance);
+
+    // Evicts cold descriptions until the budget is met; call once per frame. A cold
+    // description that still has instances is passed to releaseIdle, which may free
+    // instances that are only being held for reuse (e.g. pooled ones) so the
+    // description can be evicted on a later frame once FMOD has destroyed them.
+    void Update(const std::function<bool(FMOD::Studio::EventDescription*)>& releaseIdle = nullptr);
+
+    // Drops entries whose descriptions were invalidated by a bank unload
+    void RemoveInvalid();
+    void Clear();
+
+    SampleResidencyStats GetStats() const;
+
+private:
+    struct Entry
+    {
+        FMOD::Studio::EventDescription* description = nullptr;
+        size_t bytes = 0;
+        bool measured = false;
+    };
+
+    size_t m_BudgetBytes = 64 * 1024 * 1024;
+    size_t m_DefaultDescriptionBytes = 256 * 1024;
+    size_t m_ResidentBytes = 0;
+    uint64_t m_Loads = 0;
+    uint64_t m_Evictions = 0;
+
+    // Most recently used at the front
+    std::list<Entry> m_Lru;
+    std::unordered_map<FMOD::Studio::EventDescription*, std::list<Entry>::iterator> m_Entries;
+};
@@ -0,0 +1,384 @@
+// SoundCache.cpp
+#include "SoundCache.h"
+#include <fmod_errors.h>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    // Deferred releases per Update, so a large eviction doesn't land in one frame
+    constexpr size_t kMaxReleasesPerUpdate = 8;
+}
+
+void SoundCache::SetPolicyThresholds(size_t compressedFromBytes, size_t streamFromBytes)
+{
+    m_CompressedFromBytes = compressedFromBytes;
+    m_StreamFromBytes = (streamFromBytes > compressedFromBytes) ? streamFromBytes : compressedFromBytes;
+}
+
+SoundLoadPolicy SoundCache::ChoosePolicy(size_t fileBytes) const
+{
+    // Short effects decode to PCM; longer files stay compressed; long music and
+    // ambience beds stream. An unreadable size falls through to FMOD's own error.
+    if (fileBytes >= m_StreamFromBytes)
+    {
+        return SoundLoadPolicy::Stream;
+    }
+
+    if (fileBytes >= m_CompressedFromBytes)
+    {
+        return SoundLoadPolicy::CompressedSample;
+    }
+
+    return SoundLoadPolicy::DecompressedSample;
+}
+
+SoundHandle SoundCache::AllocateSlot(std::list<Entry>::iterator entry)
+{
+    uint32_t index;
+    if (!m_FreeSlots.empty())
+    {
+        index = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.emplace_back();
+    }
+
+    Slot& slot = m_Slots[index];
+    slot.entry = entry;
+    slot.used = true;
+    return (static_cast<SoundHandle>(slot.generation) << 32) | index;
+}
+
+void SoundCache::FreeSlot(SoundHandle handle)
+{
+    // Skip 0 on wrap-around so a live handle is never kInvalidSoundHandle
+    uint32_t index = static_cast<uint32_t>(handle);
+    Slot& slot = m_Slots[index];
+    slot.used = false;
+    if (++slot.generation == 0)
+    {
+        slot.generation = 1;
+    }
+    m_FreeSlots.push_back(index);
+}
+
+SoundCache::Entry* SoundCache::Find(SoundHandle handle)
+{
+    uint32_t index = static_cast<uint32_t>(handle);
+    uint32_t generation = static_cast<uint32_t>(handle >> 32);
+    if (index >= m_Slots.size() || !m_Slots[index].used || m_Slots[index].generation != generation)
+    {
+        return nullptr;
+    }
+
+    return &*m_Slots[index].entry;
+}
+
+FMOD::Sound* SoundCache::Get(SoundHandle handle) const
+{
+    const Entry* entry = const_cast<SoundCache*>(this)->Find(handle);
+    return (entry != nullptr) ? entry->sound : nullptr;
+}
+
+SoundHandle SoundCache::Load(FMOD::System* coreSystem, const std::string& soundPath, bool loop, SoundLoadPolicy policy)
+{
+    auto it = m_ByPath.find(soundPath);
+    if (it != m_ByPath.end())
+    {
+        // Move to the front of the LRU list
+        m_Lru.splice(m_Lru.begin(), m_Lru, it->second);
+        ++m_Stats.hits;
+        return it->second->handle;
+    }
+
+    ++m_Stats.misses;
+
+    if (policy == SoundLoadPolicy::Auto)
+    {
+        std::error_code error;
+        uintmax_t fileSize = std::filesystem::file_size(soundPath, error);
+        policy = ChoosePolicy(error ? 0 : static_cast<size_t>(fileSize));
+    }
+
+    // Open in the background; Update measures the sound once it is ready
+    FMOD_MODE mode = FMOD_DEFAULT | FMOD_NONBLOCKING;
+    if (loop)
+    {
+        mode |= FMOD_LOOP_NORMAL;
+    }
+
+    if (policy == SoundLoadPolicy::CompressedSample)
+    {
+        mode |= FMOD_CREATECOMPRESSEDSAMPLE;
+    }
+
+    FMOD::Sound* sound = nullptr;
+    FMOD_RESULT result = FMOD_OK;
+    if (policy == SoundLoadPolicy::Stream)
+    {
+        result = coreSystem->createStream(soundPath.c_str(), mode, nullptr, &sound);
+    }
+    else
+    {
+        result = coreSystem->createSound(soundPath.c_str(), mode, nullptr, &sound);
+    }
+
+    if (result != FMOD_OK || sound == nullptr)
+    {
+        std::cerr << "FMOD: Failed to load sound '" << soundPath << "': " << FMOD_ErrorString(result) << std::endl;
+        return kInvalidSoundHandle;
+    }
+
+    Entry entry;
+    entry.path = soundPath;
+    entry.sound = sound;
+    entry.policy = policy;
+    m_Lru.push_front(entry);
+    m_Lru.front().handle = AllocateSlot(m_Lru.begin());
+    m_ByPath[soundPath] = m_Lru.begin();
+    m_Opening.push_back(m_Lru.front().handle);
+    return m_Lru.front().handle;
+}
+
+bool SoundCache::IsReady(FMOD::Sound* sound)
+{
+    if (sound == nullptr)
+    {
+        return false;
+    }
+
+    FMOD_OPENSTATE state = FMOD_OPENSTATE_ERROR;
+    if (sound->getOpenState(&state, nullptr, nullptr, nullptr) != FMOD_OK)
+    {
+        return false;
+    }
+
+    // A stream that is playing or seeking has finished opening
+    return state == FMOD_OPENSTATE_READY || state == FMOD_OPENSTATE_PLAYING ||
+           state == FMOD_OPENSTATE_SEEKING || state == FMOD_OPENSTATE_SETPOSITION;
+}
+
+bool SoundCache::WaitUntilOpen(FMOD::Sound* sound, float timeoutSeconds)
+{
+    // FMOD opens non-blocking sounds on its own loader thread; nothing to pump here
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(timeoutSeconds));
+    FMOD_OPENSTATE state = FMOD_OPENSTATE_LOADING;
+    while (!IsReady(sound) && std::chrono::steady_clock::now() < deadline)
+    {
+        if (sound->getOpenState(&state, nullptr, nullptr, nullptr) != FMOD_OK || state == FMOD_OPENSTATE_ERROR)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return IsReady(sound);
+}
+
+void SoundCache::OnPlayed(SoundHandle handle, FMOD::Channel* channel)
+{
+    Entry* entry = Find(handle);
+    if (entry == nullptr)
+    {
+        return;
+    }
+
+    m_Lru.splice(m_Lru.begin(), m_Lru, m_Slots[static_cast<uint32_t>(handle)].entry);
+    ++entry->playingChannels;
+    m_PlayingChannels.emplace_back(channel, handle);
+}
+
+void SoundCache::Measure(Entry& entry)
+{
+    unsigned int length = 0;
+    if (entry.policy == SoundLoadPolicy::DecompressedSample)
+    {
+        entry.sound->getLength(&length, FMOD_TIMEUNIT_PCMBYTES);
+        entry.bytes = length;
+    }
+    else if (entry.policy == SoundLoadPolicy::CompressedSample)
+    {
+        entry.sound->getLength(&length, FMOD_TIMEUNIT_RAWBYTES);
+        entry.bytes = length;
+    }
+    else
+    {
+        // Streams hold a decode buffer (400 ms by default) plus a 16 KB file buffer
+        int channels = 0;
+        int bits = 0;
+        float frequency = 0.0f;
+        entry.sound->getFormat(nullptr, nullptr, &channels, &bits);
+        entry.sound->getDefaults(&frequency, nullptr);
+        size_t bytesPerSecond = static_cast<size_t>(frequency) * channels * (bits / 8);
+        entry.bytes = (bytesPerSecond * 400) / 1000 + 16 * 1024;
+    }
+
+    entry.measured = true;
+    m_ResidentBytes += entry.bytes;
+}
+
+void SoundCache::Update()
+{
+    // Measure sounds that finished opening
+    for (size_t i = 0; i < m_Opening.size();)
+    {
+        Entry* opening = Find(m_Opening[i]);
+        if (opening == nullptr)
+        {
+            m_Opening[i] = m_Opening.back();
+            m_Opening.pop_back();
+            continue;
+        }
+
+        // getOpenState returns the failure reason once the state is ERROR
+        Entry& entry = *opening;
+        FMOD_OPENSTATE state = FMOD_OPENSTATE_LOADING;
+        FMOD_RESULT openResult = entry.sound->getOpenState(&state, nullptr, nullptr, nullptr);
+        if (state == FMOD_OPENSTATE_ERROR)
+        {
+            // Measured as empty so it becomes evictable; it never plays
+            std::cerr << "FMOD: Failed to open sound '" << entry.path << "': " << FMOD_ErrorString(openResult) << std::endl;
+            entry.measured = true;
+        }
+        else if (IsReady(entry.sound))
+        {
+            Measure(entry);
+        }
+        else
+        {
+            ++i;
+            continue;
+        }
+
+        m_Opening[i] = m_Opening.back();
+        m_Opening.pop_back();
+    }
+
+    // Unpin sounds whose channels have stopped (or were stolen, invalidating the handle)
+    for (size_t i = 0; i < m_PlayingChannels.size();)
+    {
+        bool playing = false;
+        FMOD_RESULT result = m_PlayingChannels[i].first->isPlaying(&playing);
+        if (result == FMOD_OK && playing)
+        {
+            ++i;
+            continue;
+        }
+
+        if (Entry* entry = Find(m_PlayingChannels[i].second))
+        {
+            --entry->playingChannels;
+        }
+
+        m_PlayingChannels[i] = m_PlayingChannels.back();
+        m_PlayingChannels.pop_back();
+    }
+
+    if (m_ResidentBytes > m_BudgetBytes)
+    {
+        Evict();
+    }
+
+    if (!m_PendingRelease.empty())
+    {
+        ReleaseDeferred();
+    }
+}
+
+void SoundCache::Evict()
+{
+    // Walk from the least recently used end, skipping anything opening or playing
+    auto it = m_Lru.end();
+    while (it != m_Lru.begin() && m_ResidentBytes > m_BudgetBytes)
+    {
+        --it;
+
+        if (!it->measured || it->playingChannels > 0)
+        {
+            continue;
+        }
+
+        m_ResidentBytes -= it->bytes;
+        ++m_Stats.evictions;
+
+        m_PendingRelease.push_back(it->sound);
+        FreeSlot(it->handle);
+        m_ByPath.erase(it->path);
+        it = m_Lru.erase(it);
+    }
+}
+
+void SoundCache::ReleaseDeferred()
+{
+    for (size_t released = 0; released < kMaxReleasesPerUpdate && !m_PendingRelease.empty(); ++released)
+    {
+        m_PendingRelease.back()->release();
+        m_PendingRelease.pop_back();
+    }
+}
+
+void SoundCache::Clear()
+{
+    // Slot generations survive so handles from before the Clear stay stale
+    for (auto& entry : m_Lru)
+    {
+        entry.sound->release();
+        FreeSlot(entry.handle);
+    }
+
+    for (FMOD::Sound* sound : m_PendingRelease)
+    {
+        sound->release();
+    }
+
+    m_Lru.clear();
+    m_ByPath.clear();
+    m_Opening.clear();
+    m_PlayingChannels.clear();
+    m_PendingRelease.clear();
+    m_ResidentBytes = 0;
+}
+
+SoundMemoryStats SoundCache::GetMemoryStats() const
+{
+    SoundMemoryStats stats;
+    stats.budgetBytes = m_BudgetBytes;
+
+    for (const auto& entry : m_Lru)
+    {
+        if (entry.playingChannels > 0)
+        {
+            ++stats.pinnedCount;
+        }
+
+        if (!entry.measured)
+        {
+            ++stats.loadingCount;
+            continue;
+        }
+
+        switch (entry.policy)
+        {
+        case SoundLoadPolicy::CompressedSample:
+            stats.compressedBytes += entry.bytes;
+            ++stats.compressedCount;
+            break;
+        case SoundLoadPolicy::Stream:
+            stats.streamBytes += entry.bytes;
+            ++stats.streamCount;
+            break;
+        default:
+            stats.decompressedBytes += entry.bytes;
+            ++stats.decompressedCount;
+            break;
+        }
+    }
+
+    return stats;
+}
@@ -0,0 +1,120 @@
+// SoundCache.h - Byte-budgeted LRU cache of Core API sounds
+#pragma once
+
+#include <fmod.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AudioCacheStats.h"
+
+// How LoadSound keeps a sound's audio data in memory
+enum class SoundLoadPolicy
+{
+    Auto,               // Pick from the file size (see SetPolicyThresholds)
+    DecompressedSample, // Decode the whole file to PCM up front; cheapest to play
+    CompressedSample,   // Keep the compressed data and decode per voice while playing
+    Stream              // Read and decode from disk while playing; one voice per sound
+};
+
+// Bytes held by cached sounds, per load policy. Decompressed and compressed sizes are
+// measured once a sound finishes opening; streams are charged their decode buffers.
+struct SoundMemoryStats
+{
+    size_t budgetBytes = 0;
+    size_t decompressedBytes = 0;
+    size_t compressedBytes = 0;
+    size_t streamBytes = 0;
+    int decompressedCount = 0;
+    int compressedCount = 0;
+    int streamCount = 0;
+    int loadingCount = 0;
+    int pinnedCount = 0;
+
+    size_t GetTotalBytes() const { return decompressedBytes + compressedBytes + streamBytes; }
+};
+
+// Generational reference to a cached sound: slot in the low 32 bits, slot generation
+// in the high 32. Eviction bumps the generation, so a handle to an evicted sound stops
+// resolving instead of aliasing a sound later created at the same address.
+using SoundHandle = uint64_t;
+constexpr SoundHandle kInvalidSoundHandle = 0;
+
+// Owns every sound created through FMODAudioSystem::LoadSound, handing out
+// SoundHandles rather than raw pointers. Sounds open with FMOD_NONBLOCKING, are
+// pinned while a channel started through PlaySound is still playing them, and the
+// least recently used unpinned sounds are evicted once the byte budget is exceeded. Evicted sounds are released a few per Update, and only
+// once they have finished opening, so eviction never stalls the caller.
+class SoundCache
+{
+public:
+    void SetBudget(size_t budgetBytes) { m_BudgetBytes = budgetBytes; }
+    void SetPolicyThresholds(size_t compressedFromBytes, size_t streamFromBytes);
+
+    // Returns the cached sound for the path (a hit) or starts opening it (a miss)
+    SoundHandle Load(FMOD::System* coreSystem, const std::string& soundPath, bool loop, SoundLoadPolicy policy);
+
+    // The sound behind a handle, or nullptr once it has been evicted
+    FMOD::Sound* Get(SoundHandle handle) const;
+    static bool IsReady(FMOD::Sound* sound);
+
+    // Blocks until a sound still opening has opened (or failed); returns IsReady
+    static bool WaitUntilOpen(FMOD::Sound* sound, float timeoutSeconds);
+
+    // Marks the sound as used and pins it until the channel stops
+    void OnPlayed(SoundHandle handle, FMOD::Channel* channel);
+
+    // Measures opened sounds, unpins finished channels, evicts and releases; call once per frame
+    void Update();
+
+    // Releases every sound immediately (blocks on sounds still opening)
+    void Clear();
+
+    const AudioCacheStats& GetStats() const { return m_Stats; }
+    SoundMemoryStats GetMemoryStats() const;
+
+private:
+    struct Entry
+    {
+        std::string path;
+        SoundHandle handle = kInvalidSoundHandle;
+        FMOD::Sound* sound = nullptr;
+        SoundLoadPolicy policy = SoundLoadPolicy::DecompressedSample;
+        size_t bytes = 0;        // Valid once measured
+        bool measured = false;   // False while opening; unmeasured sounds are never evicted
+        int playingChannels = 0;
+    };
+
+    struct Slot
+    {
+        std::list<Entry>::iterator entry;
+        uint32_t generation = 1;
+        bool used = false;
+    };
+
+    SoundLoadPolicy ChoosePolicy(size_t fileBytes) const;
+    Entry* Find(SoundHandle handle);
+    SoundHandle AllocateSlot(std::list<Entry>::iterator entry);
+    void FreeSlot(SoundHandle handle);
+    void Measure(Entry& entry);
+    void Evict();
+    void ReleaseDeferred();
+
+    size_t m_BudgetBytes = 64 * 1024 * 1024;
+    size_t m_CompressedFromBytes = 256 * 1024;
+    size_t m_StreamFromBytes = 2 * 1024 * 1024;
+    size_t m_ResidentBytes = 0;
+    AudioCacheStats m_Stats;
+
+    // Most recently used at the front
+    std::list<Entry> m_Lru;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_ByPath;
+    std::vector<Slot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+
+    std::vector<SoundHandle> m_Opening;
+    std::vector<std::pair<FMOD::Channel*, SoundHandle>> m_PlayingChannels;
+    std::vector<FMOD::Sound*> m_PendingRelease;
+};
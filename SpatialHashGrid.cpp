@@ -0,0 +1,173 @@
+// SpatialHashGrid.cpp
+#include "SpatialHashGrid.h"
+#include <cmath>
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+    : m_CellSize(cellSize)
+    , m_InverseCellSize(1.0f / cellSize)
+{
+}
+
+void SpatialHashGrid::SetCellSize(float cellSize)
+{
+    if (cellSize <= 0.0f || cellSize == m_CellSize)
+    {
+        return;
+    }
+
+    std::vector<CellItem> items;
+    items.reserve(m_Entries.size());
+    for (const auto& cell : m_Cells)
+    {
+        items.insert(items.end(), cell.second.begin(), cell.second.end());
+    }
+
+    Clear();
+    m_CellSize = cellSize;
+    m_InverseCellSize = 1.0f / cellSize;
+
+    for (const CellItem& item : items)
+    {
+        AddToCell(item.id, item.x, item.y);
+    }
+}
+
+int32_t SpatialHashGrid::CellCoord(float value) const
+{
+    return static_cast<int32_t>(std::floor(value * m_InverseCellSize));
+}
+
+uint64_t SpatialHashGrid::CellKey(int32_t cellX, int32_t cellY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+}
+
+void SpatialHashGrid::AddToCell(uint32_t id, float x, float y)
+{
+    uint64_t key = CellKey(CellCoord(x), CellCoord(y));
+    std::vector<CellItem>& cell = m_Cells[key];
+
+    Entry entry;
+    entry.cellKey = key;
+    entry.indexInCell = static_cast<uint32_t>(cell.size());
+    cell.push_back({ id, x, y });
+    m_Entries[id] = entry;
+}
+
+void SpatialHashGrid::RemoveFromCell(const Entry& entry)
+{
+    auto it = m_Cells.find(entry.cellKey);
+    std::vector<CellItem>& cell = it->second;
+
+    // Swap the last item into the hole and fix its back-reference
+    if (entry.indexInCell + 1 != cell.size())
+    {
+        cell[entry.indexInCell] = cell.back();
+        m_Entries[cell[entry.indexInCell].id].indexInCell = entry.indexInCell;
+    }
+    cell.pop_back();
+
+    if (cell.empty())
+    {
+        m_Cells.erase(it);
+    }
+}
+
+void SpatialHashGrid::Insert(uint32_t id, float x, float y)
+{
+    auto it = m_Entries.find(id);
+    if (it != m_Entries.end())
+    {
+        Move(id, x, y);
+        return;
+    }
+
+    AddToCell(id, x, y);
+}
+
+void SpatialHashGrid::Move(uint32_t id, float x, float y)
+{
+    auto it = m_Entries.find(id);
+    if (it == m_Entries.end())
+    {
+        return;
+    }
+
+    // Same cell: just update the stored position
+    Entry entry = it->second;
+    if (CellKey(CellCoord(x), CellCoord(y)) == entry.cellKey)
+    {
+        CellItem& item = m_Cells[entry.cellKey][entry.indexInCell];
+        item.x = x;
+        item.y = y;
+        return;
+    }
+
+    RemoveFromCell(entry);
+    AddToCell(id, x, y);
+}
+
+void SpatialHashGrid::Remove(uint32_t id)
+{
+    auto it = m_Entries.find(id);
+    if (it == m_Entries.end())
+    {
+        return;
+    }
+
+    Entry entry = it->second;
+    m_Entries.erase(it);
+    RemoveFromCell(entry);
+}
+
+void SpatialHashGrid::Clear()
+{
+    m_Cells.clear();
+    m_Entries.clear();
+}
+
+void SpatialHashGrid::QueryCell(const std::vector<CellItem>& cell, float x, float y, float radiusSquared, std::vector<uint32_t>& results)
+{
+    for (const CellItem& item : cell)
+    {
+        float dx = item.x - x;
+        float dy = item.y - y;
+        if (dx * dx + dy * dy <= radiusSquared)
+        {
+            results.push_back(item.id);
+        }
+    }
+}
+
+void SpatialHashGrid::QueryRadius(float x, float y, float radius, std::vector<uint32_t>& results) const
+{
+    float radiusSquared = radius * radius;
+
+    int32_t minX = CellCoord(x - radius);
+    int32_t maxX = CellCoord(x + radius);
+    int32_t minY = CellCoord(y - radius);
+    int32_t maxY = CellCoord(y + radius);
+
+    // A huge radius covers more cells than exist; walk the occupied ones instead
+    double coveredCells = (static_cast<double>(maxX) - minX + 1.0) * (static_cast<double>(maxY) - minY + 1.0);
+    if (coveredCells > static_cast<double>(m_Cells.size()))
+    {
+        for (const auto& cell : m_Cells)
+        {
+            QueryCell(cell.second, x, y, radiusSquared, results);
+        }
+        return;
+    }
+
+    for (int32_t cellX = minX; cellX <= maxX; ++cellX)
+    {
+        for (int32_t cellY = minY; cellY <= maxY; ++cellY)
+        {
+            auto it = m_Cells.find(CellKey(cellX, cellY));
+            if (it != m_Cells.end())
+            {
+                QueryCell(it->second, x, y, radiusSquared, results);
+            }
+        }
+    }
+}
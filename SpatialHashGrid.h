@@ -0,0 +1,56 @@
+// SpatialHashGrid.h - Uniform 2D hash grid for emitter proximity queries
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Buckets IDs by the grid cell their x/y position falls in. Moving an ID only
+// touches the grid when it crosses a cell boundary, and a radius query visits
+// just the cells overlapping the circle, so its cost follows the number of
+// nearby IDs rather than the total.
+class SpatialHashGrid
+{
+public:
+    explicit SpatialHashGrid(float cellSize = 50.0f);
+
+    // Re-buckets everything already in the grid
+    void SetCellSize(float cellSize);
+    float GetCellSize() const { return m_CellSize; }
+
+    void Insert(uint32_t id, float x, float y);
+    void Move(uint32_t id, float x, float y);
+    void Remove(uint32_t id);
+    void Clear();
+
+    // Appends the IDs within radius of (x, y); does not clear the output
+    void QueryRadius(float x, float y, float radius, std::vector<uint32_t>& results) const;
+
+    size_t Size() const { return m_Entries.size(); }
+
+private:
+    struct CellItem
+    {
+        uint32_t id;
+        float x;
+        float y;
+    };
+
+    struct Entry
+    {
+        uint64_t cellKey;
+        uint32_t indexInCell;
+    };
+
+    int32_t CellCoord(float value) const;
+    static uint64_t CellKey(int32_t cellX, int32_t cellY);
+    void AddToCell(uint32_t id, float x, float y);
+    void RemoveFromCell(const Entry& entry);
+    static void QueryCell(const std::vector<CellItem>& cell, float x, float y, float radiusSquared, std::vector<uint32_t>& results);
+
+    float m_CellSize;
+    float m_InverseCellSize;
+    std::unordered_map<uint64_t, std::vector<CellItem>> m_Cells;
+    std::unordered_map<uint32_t, Entry> m_Entries;
+};
@@ -0,0 +1,331 @@
+// VirtualVoiceManager.cpp
+#include "VirtualVoiceManager.h"
+#include "FMODAudioSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+VirtualVoiceId VirtualVoiceManager::Add(const std::string& eventPath, float x, float y, float priority, float loudness)
+{
+    FMOD::Studio::EventDescription* description = FMODAudioSystem::GetInstance().GetEventDescription(AudioEventId(eventPath));
+    if (description == nullptr)
+    {
+        std::cerr << "FMOD: Cannot add virtual emitter for '" << eventPath << "'" << std::endl;
+        return kInvalidVirtualVoiceId;
+    }
+
+    bool oneshot = false;
+    description->isOneshot(&oneshot);
+    if (oneshot)
+    {
+        std::cerr << "FMOD: Cannot add virtual emitter for one-shot event '" << eventPath << "'" << std::endl;
+        return kInvalidVirtualVoiceId;
+    }
+
+    Voice voice;
+    voice.eventPath = eventPath;
+    voice.x = x;
+    voice.y = y;
+    voice.priority = priority;
+    voice.loudness = loudness;
+
+    bool is3D = false;
+    float minDistance = 0.0f;
+    description->is3D(&is3D);
+    if (is3D)
+    {
+        description->getMinMaxDistance(&minDistance, &voice.maxDistance);
+    }
+    description->getLength(&voice.loopEndMs);
+
+    // Starts virtual; the timeline runs from now whether or not it is heard yet
+    voice.virtualSince = std::chrono::steady_clock::now();
+
+    VirtualVoiceId id = m_NextId++;
+    voice.id = id;
+    m_Voices[id] = voice;
+
+    if (voice.maxDistance > 0.0f)
+    {
+        m_Grid.Insert(id, x, y);
+        m_QueryRadius = std::max(m_QueryRadius, voice.maxDistance);
+    }
+    else
+    {
+        m_Unbounded.push_back(id);
+    }
+
+    return id;
+}
+
+void VirtualVoiceManager::Remove(VirtualVoiceId id)
+{
+    auto it = m_Voices.find(id);
+    if (it == m_Voices.end())
+    {
+        return;
+    }
+
+    if (it->second.instance != nullptr)
+    {
+        Demote(it->second);
+    }
+
+    float maxDistance = it->second.maxDistance;
+    if (maxDistance > 0.0f)
+    {
+        m_Grid.Remove(id);
+    }
+    else
+    {
+        m_Unbounded.erase(std::find(m_Unbounded.begin(), m_Unbounded.end(), id));
+    }
+
+    m_Voices.erase(it);
+
+    if (maxDistance > 0.0f && maxDistance >= m_QueryRadius)
+    {
+        RecomputeQueryRadius();
+    }
+}
+
+void VirtualVoiceManager::RecomputeQueryRadius()
+{
+    m_QueryRadius = 0.0f;
+    for (const auto& entry : m_Voices)
+    {
+        m_QueryRadius = std::max(m_QueryRadius, entry.second.maxDistance);
+    }
+}
+
+void VirtualVoiceManager::SetPosition(VirtualVoiceId id, float x, float y)
+{
+    auto it = m_Voices.find(id);
+    if (it == m_Voices.end())
+    {
+        return;
+    }
+
+    Voice& voice = it->second;
+    voice.x = x;
+    voice.y = y;
+
+    if (voice.maxDistance > 0.0f)
+    {
+        m_Grid.Move(id, x, y);
+    }
+
+    if (voice.emitter != kInvalidEmitterId)
+    {
+        EmitterUpdate update;
+        update.id = voice.emitter;
+        update.x = x;
+        update.y = y;
+        FMODAudioSystem::GetInstance().UpdateEmitters(std::span<const EmitterUpdate>(&update, 1));
+    }
+}
+
+void VirtualVoiceManager::SetPriority(VirtualVoiceId id, float priority)
+{
+    auto it = m_Voices.find(id);
+    if (it != m_Voices.end())
+    {
+        it->second.priority = priority;
+    }
+}
+
+void VirtualVoiceManager::SetLoopRegion(VirtualVoiceId id, int startMs, int endMs)
+{
+    auto it = m_Voices.find(id);
+    if (it != m_Voices.end() && startMs >= 0 && endMs > startMs)
+    {
+        it->second.loopStartMs = startMs;
+        it->second.loopEndMs = endMs;
+    }
+}
+
+float VirtualVoiceManager::Score(const Voice& voice, const AudioListenerSet& listeners) const
+{
+    // Linear rolloff is a cheap stand-in for the event's real attenuation curve
+    float attenuation = 1.0f;
+    if (voice.maxDistance > 0.0f)
+    {
+        float distance = std::sqrt(listeners.NearestDistanceSquared(voice.x, voice.y));
+        attenuation = std::max(0.0f, 1.0f - distance / voice.maxDistance);
+    }
+
+    return voice.priority * voice.loudness * attenuation;
+}
+
+void VirtualVoiceManager::Consider(VirtualVoiceId id, const AudioListenerSet& listeners)
+{
+    auto it = m_Voices.find(id);
+    if (it == m_Voices.end() || it->second.scoredUpdate == m_UpdateCount)
+    {
+        return;
+    }
+
+    Voice& voice = it->second;
+    voice.scoredUpdate = m_UpdateCount;
+
+    // A Restart or bank unload takes real instances with it
+    if (voice.instance != nullptr && !voice.instance->isValid())
+    {
+        FMODAudioSystem::GetInstance().UnregisterEmitter(voice.emitter);
+        voice.instance = nullptr;
+        voice.emitter = kInvalidEmitterId;
+        voice.virtualSince = std::chrono::steady_clock::now();
+        m_RealIds.erase(std::find(m_RealIds.begin(), m_RealIds.end(), id));
+    }
+
+    voice.score = Score(voice, listeners);
+    m_Ranked.push_back(&voice);
+}
+
+void VirtualVoiceManager::Update(const AudioListenerSet& listeners)
+{
+    ++m_UpdateCount;
+    m_Ranked.clear();
+
+    // Only emitters that could be audible compete for real voices; current real
+    // voices are always included so ones that moved out of range get demoted
+    for (int l = 0; l < listeners.count; ++l)
+    {
+        m_Nearby.clear();
+        m_Grid.QueryRadius(listeners.x[l], listeners.y[l], m_QueryRadius, m_Nearby);
+        for (VirtualVoiceId id : m_Nearby)
+        {
+            Consider(id, listeners);
+        }
+    }
+
+    for (VirtualVoiceId id : m_Unbounded)
+    {
+        Consider(id, listeners);
+    }
+
+    // Consider may drop invalidated voices from the real list
+    m_Nearby.assign(m_RealIds.begin(), m_RealIds.end());
+    for (VirtualVoiceId id : m_Nearby)
+    {
+        Consider(id, listeners);
+    }
+
+    // Rank with real voices boosted, so a newcomer has to be clearly better to take a slot
+    float boost = 1.0f + m_Hysteresis;
+    auto ranking = [boost](const Voice* a, const Voice* b) {
+        float scoreA = (a->instance != nullptr) ? a->score * boost : a->score;
+        float scoreB = (b->instance != nullptr) ? b->score * boost : b->score;
+        return scoreA > scoreB;
+    };
+
+    size_t realCount = std::min(m_Ranked.size(), static_cast<size_t>(std::max(m_MaxRealVoices, 0)));
+    if (realCount < m_Ranked.size())
+    {
+        std::nth_element(m_Ranked.begin(), m_Ranked.begin() + realCount, m_Ranked.end(), ranking);
+    }
+
+    // Free slots first so the number of real instances never exceeds the limit
+    for (size_t i = 0; i < m_Ranked.size(); ++i)
+    {
+        Voice& voice = *m_Ranked[i];
+        bool wanted = (i < realCount) && voice.score > 0.0f;
+        if (!wanted && voice.instance != nullptr)
+        {
+            Demote(voice);
+        }
+    }
+
+    for (size_t i = 0; i < realCount; ++i)
+    {
+        Voice& voice = *m_Ranked[i];
+        if (voice.score > 0.0f && voice.instance == nullptr)
+        {
+            Promote(voice);
+        }
+    }
+}
+
+int VirtualVoiceManager::WrapToLoopRegion(const Voice& voice, int positionMs)
+{
+    // Anything before the loop end plays through once; past it, the loop repeats
+    int loopLengthMs = voice.loopEndMs - voice.loopStartMs;
+    if (loopLengthMs <= 0 || positionMs < voice.loopEndMs)
+    {
+        return positionMs;
+    }
+
+    return voice.loopStartMs + (positionMs - voice.loopStartMs) % loopLengthMs;
+}
+
+void VirtualVoiceManager::Promote(Voice& voice)
+{
+    FMODAudioSystem& audioSystem = FMODAudioSystem::GetInstance();
+
+    FMOD::Studio::EventInstance* instance = audioSystem.CreateEventInstance(AudioEventId(voice.eventPath));
+    if (instance == nullptr)
+    {
+        return;
+    }
+
+    voice.emitter = audioSystem.RegisterEmitter(instance, voice.x, voice.y);
+    instance->start();
+
+    // Pick up where the timeline would be had it kept playing. Set after start(), which
+    // would otherwise reset the timeline to zero.
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - voice.virtualSince;
+    instance->setTimelinePosition(WrapToLoopRegion(voice, voice.timelinePositionMs + static_cast<int>(elapsed.count())));
+
+    voice.instance = instance;
+    m_RealIds.push_back(voice.id);
+    ++m_Promotions;
+}
+
+void VirtualVoiceManager::Demote(Voice& voice)
+{
+    voice.instance->getTimelinePosition(&voice.timelinePositionMs);
+    voice.instance->stop(FMOD_STUDIO_STOP_ALLOWFADEOUT);
+    voice.instance->release();
+
+    FMODAudioSystem::GetInstance().UnregisterEmitter(voice.emitter);
+    voice.instance = nullptr;
+    voice.emitter = kInvalidEmitterId;
+    voice.virtualSince = std::chrono::steady_clock::now();
+    m_RealIds.erase(std::find(m_RealIds.begin(), m_RealIds.end(), voice.id));
+    ++m_Demotions;
+}
+
+void VirtualVoiceManager::DemoteAll()
+{
+    for (auto& entry : m_Voices)
+    {
+        if (entry.second.instance != nullptr)
+        {
+            Demote(entry.second);
+        }
+    }
+}
+
+void VirtualVoiceManager::Clear()
+{
+    DemoteAll();
+
+    m_Voices.clear();
+    m_Ranked.clear();
+    m_Grid.Clear();
+    m_Unbounded.clear();
+    m_RealIds.clear();
+    m_QueryRadius = 0.0f;
+}
+
+VirtualVoiceStats VirtualVoiceManager::GetStats() const
+{
+    VirtualVoiceStats stats;
+    stats.emitters = static_cast<int>(m_Voices.size());
+    stats.real = static_cast<int>(m_RealIds.size());
+    stats.scoredLastUpdate = static_cast<int>(m_Ranked.size());
+    stats.promotions = m_Promotions;
+    stats.demotions = m_Demotions;
+    stats.virtualized = stats.emitters - stats.real;
+    return stats;
+}
@@ -0,0 +1,114 @@
+// VirtualVoiceManager.h - Top-N real instances for many looping world emitters
+#pragma once
+
+#include <fmod_studio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "EmitterStore.h"
+#include "SpatialHashGrid.h"
+
+using VirtualVoiceId = uint32_t;
+constexpr VirtualVoiceId kInvalidVirtualVoiceId = 0;
+
+struct VirtualVoiceStats
+{
+    int emitters = 0;
+    int real = 0;
+    int virtualized = 0;
+    int scoredLastUpdate = 0; // Emitters near a listener, 2D emitters and real voices
+    uint64_t promotions = 0; // Virtual -> real
+    uint64_t demotions = 0;  // Real -> virtual
+};
+
+// Every looping emitter is a lightweight record. Each Update scores them by priority,
+// estimated loudness and distance to the nearest listener, and only the best N own a real
+// EventInstance. A real voice's score is boosted by the hysteresis factor when ranked
+// so two similar emitters don't trade places every tick. A demoted voice remembers its
+// timeline position and keeps advancing it virtually, so it resumes where it would
+// have been when promoted again. 3D emitters live in a spatial hash grid, so each
+// Update only scores emitters within audible range of a listener (plus 2D emitters
+// and current real voices) instead of every emitter.
+class VirtualVoiceManager
+{
+public:
+    // Looping events only; one-shots are rejected since they'd never need a real voice back
+    VirtualVoiceId Add(const std::string& eventPath, float x, float y, float priority, float loudness);
+    void Remove(VirtualVoiceId id);
+    void SetPosition(VirtualVoiceId id, float x, float y);
+    void SetPriority(VirtualVoiceId id, float priority);
+
+    // The event's loop region, which a virtual voice's timeline position wraps within.
+    // Defaults to the whole timeline; set it for events with an intro before the loop.
+    void SetLoopRegion(VirtualVoiceId id, int startMs, int endMs);
+
+    void SetMaxRealVoices(int maxRealVoices) { m_MaxRealVoices = maxRealVoices; }
+    void SetHysteresis(float hysteresis) { m_Hysteresis = hysteresis; }
+    void SetGridCellSize(float cellSize) { m_Grid.SetCellSize(cellSize); }
+
+    // Appends the 3D emitters within radius of (x, y)
+    void QueryRadius(float x, float y, float radius, std::vector<VirtualVoiceId>& results) const { m_Grid.QueryRadius(x, y, radius, results); }
+
+    // Rescores every emitter and promotes/demotes; call once per FMOD update
+    void Update(const AudioListenerSet& listeners);
+
+    // Sends every real voice virtual, remembering its timeline position; the next
+    // Update promotes the winners again
+    void DemoteAll();
+
+    // Stops and releases every real voice and forgets all emitters
+    void Clear();
+
+    VirtualVoiceStats GetStats() const;
+
+private:
+    struct Voice
+    {
+        VirtualVoiceId id = kInvalidVirtualVoiceId;
+        std::string eventPath;
+        float x = 0.0f;
+        float y = 0.0f;
+        float priority = 1.0f;
+        float loudness = 1.0f;
+        float maxDistance = 0.0f; // From the event description; 0 for 2D events
+        int loopStartMs = 0;      // Loop region the virtual position wraps within;
+        int loopEndMs = 0;        // defaults to the timeline length
+
+        FMOD::Studio::EventInstance* instance = nullptr;
+        EmitterId emitter = kInvalidEmitterId;
+
+        // Where the timeline was when the voice went virtual, and when that was
+        int timelinePositionMs = 0;
+        std::chrono::steady_clock::time_point virtualSince;
+
+        float score = 0.0f;
+        uint32_t scoredUpdate = 0; // Update in which it was last scored
+    };
+
+    float Score(const Voice& voice, const AudioListenerSet& listeners) const;
+    static int WrapToLoopRegion(const Voice& voice, int positionMs);
+    void Promote(Voice& voice);
+    void Demote(Voice& voice);
+    void Consider(VirtualVoiceId id, const AudioListenerSet& listeners);
+    void RecomputeQueryRadius();
+
+    int m_MaxRealVoices = 32;
+    float m_Hysteresis = 0.25f;
+
+    VirtualVoiceId m_NextId = 1;
+    std::unordered_map<VirtualVoiceId, Voice> m_Voices;
+    std::vector<Voice*> m_Ranked;
+    uint32_t m_UpdateCount = 0;
+
+    // 3D emitters by position; 2D emitters are audible everywhere and always scored
+    SpatialHashGrid m_Grid;
+    std::vector<VirtualVoiceId> m_Unbounded;
+    std::vector<VirtualVoiceId> m_RealIds;
+    std::vector<VirtualVoiceId> m_Nearby;
+    float m_QueryRadius = 0.0f; // Largest max distance of any 3D emitter
+
+    uint64_t m_Promotions = 0;
+    uint64_t m_Demotions = 0;
+};
@@ -46,10 +46,12 @@ int main()
 
 #include <iostream>        // For cout/cerr output
 #include "GameAudioManager.h" // Your audio manager class
+#include "AudioBenchmarks.h"
 #include <thread>
 #include <chrono>
+#include <string>
 
-int main()
+int main(int argc, char* argv[])
 {
     // Initialize audio
     if (!GameAudioManager::GetInstance().Initialize())
@@ -65,6 +67,14 @@ int main()
         return 1;
     }
 
+    // "--benchmark [eventPath]" times the wrapper's hot paths instead of running the demo
+    if (argc > 1 && std::string(argv[1]) == "--benchmark")
+    {
+        AudioBenchmarks::RunAll(std::cout, (argc > 2) ? argv[2] : "");
+        GameAudioManager::GetInstance().Shutdown();
+        return 0;
+    }
+
     // Try playing the event, check result
    // Example variables for positions
     float playerX = 30; // Player's x position